@@ -0,0 +1,55 @@
+// Increments a shared counter from several threads, with fetch_add on a std::atomic of the underlying type, on a
+// fluent::atomic of the strong type, and on a strong type protected by a mutex as without fluent::atomic.
+
+#include "NamedType/atomic.hpp"
+#include "NamedType/named_type.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace
+{
+
+using BytesSent = fluent::NamedType<std::int64_t, struct BytesSentTag, fluent::Addable>;
+
+std::atomic<std::int64_t> rawCounter{0};
+fluent::atomic<BytesSent> strongCounter;
+BytesSent lockedCounter{0};
+std::mutex lockedCounterMutex;
+
+void rawAtomic(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        rawCounter.fetch_add(1, std::memory_order_relaxed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void strongAtomic(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        strongCounter.fetch_add(BytesSent{1}, std::memory_order_relaxed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void strongWithMutex(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::lock_guard<std::mutex> lock(lockedCounterMutex);
+        lockedCounter += BytesSent{1};
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(rawAtomic)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(strongAtomic)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(strongWithMutex)->ThreadRange(1, 64)->UseRealTime();
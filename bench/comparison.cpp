@@ -0,0 +1,111 @@
+// Sorts and deduplicates a million string identifiers, raw, with Comparable and with ThreeWayComparable.
+// Comparable deduces equality from two calls to operator<, ThreeWayComparable forwards it to the underlying type.
+
+#include "NamedType/named_type.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using ComparableId = fluent::NamedType<std::string, struct ComparableIdTag, fluent::Comparable>;
+using ThreeWayComparableId = fluent::NamedType<std::string, struct ThreeWayComparableIdTag, fluent::ThreeWayComparable>;
+
+std::string makeId(std::size_t i)
+{
+    // A common prefix makes each comparison walk a good part of the strings
+    return "organization/department/user-" + std::to_string(i * 7919 % 500000);
+}
+
+template <typename Id>
+Id makeTypedId(std::size_t i)
+{
+    return Id(makeId(i));
+}
+
+template <>
+std::string makeTypedId<std::string>(std::size_t i)
+{
+    return makeId(i);
+}
+
+template <typename Id>
+std::vector<Id> makeIds(std::size_t size)
+{
+    std::vector<Id> ids;
+    ids.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        ids.push_back(makeTypedId<Id>(i));
+    }
+    return ids;
+}
+
+template <typename Id>
+void sortIds(benchmark::State& state)
+{
+    auto const ids = makeIds<Id>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto sorted = ids;
+        state.ResumeTiming();
+        std::sort(begin(sorted), end(sorted));
+        benchmark::DoNotOptimize(sorted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Id>
+void uniqueIds(benchmark::State& state)
+{
+    auto ids = makeIds<Id>(static_cast<std::size_t>(state.range(0)));
+    std::sort(begin(ids), end(ids));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto unique = ids;
+        state.ResumeTiming();
+        unique.erase(std::unique(begin(unique), end(unique)), end(unique));
+        benchmark::DoNotOptimize(unique.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Id>
+void findIds(benchmark::State& state)
+{
+    auto ids = makeIds<Id>(static_cast<std::size_t>(state.range(0)));
+    std::sort(begin(ids), end(ids));
+    auto const searched = makeIds<Id>(1 << 10);
+    for (auto _ : state)
+    {
+        std::size_t found = 0;
+        for (auto const& id : searched)
+        {
+            auto const position = std::lower_bound(begin(ids), end(ids), id);
+            found += position != end(ids) && *position == id ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * (1 << 10));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(sortIds, std::string)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(sortIds, ComparableId)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(sortIds, ThreeWayComparableId)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(uniqueIds, std::string)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(uniqueIds, ComparableId)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(uniqueIds, ThreeWayComparableId)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(findIds, std::string)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(findIds, ComparableId)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(findIds, ThreeWayComparableId)->Arg(1 << 20);
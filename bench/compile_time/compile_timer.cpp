@@ -0,0 +1,131 @@
+// Runs a compiler command several times, and reports its wall time and the peak memory of the compiler.
+//   compile_timer <name> <repetitions> <output JSON file> -- <compiler> <arguments>...
+// The minimum and the median of the wall times are reported, since the compiler can only be slowed down by the
+// machine. The peak memory is the largest resident set size of the compiler processes. When the command has an
+// "-o <file>" output, the size of that file is reported too.
+
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct Measure
+{
+    double seconds;
+    long peakKilobytes;
+};
+
+bool run(std::vector<char*> const& command, Measure& measure)
+{
+    auto const start = std::chrono::steady_clock::now();
+    pid_t const child = fork();
+    if (child == -1)
+    {
+        std::perror("fork");
+        return false;
+    }
+    if (child == 0)
+    {
+        execvp(command[0], command.data());
+        std::perror(command[0]);
+        std::_Exit(127);
+    }
+
+    int status = 0;
+    rusage usage{};
+    if (wait4(child, &status, 0, &usage) == -1)
+    {
+        std::perror("wait4");
+        return false;
+    }
+    auto const end = std::chrono::steady_clock::now();
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+        std::cerr << "the compilation failed\n";
+        return false;
+    }
+
+    measure.seconds = std::chrono::duration<double>(end - start).count();
+    measure.peakKilobytes = usage.ru_maxrss;
+    return true;
+}
+
+long long outputSize(std::vector<char*> const& command)
+{
+    for (std::size_t index = 0; index + 1 < command.size() && command[index + 1] != nullptr; ++index)
+    {
+        struct stat status;
+        if (std::strcmp(command[index], "-o") == 0 && stat(command[index + 1], &status) == 0)
+        {
+            return static_cast<long long>(status.st_size);
+        }
+    }
+    return -1;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 6 || std::strcmp(argv[4], "--") != 0)
+    {
+        std::cerr << "usage: " << argv[0] << " <name> <repetitions> <output JSON file> -- <compiler> <arguments>...\n";
+        return EXIT_FAILURE;
+    }
+    std::string const name = argv[1];
+    int const repetitions = std::max(1, std::atoi(argv[2]));
+    std::string const output = argv[3];
+    std::vector<char*> command(argv + 5, argv + argc);
+    command.push_back(nullptr);
+
+    std::vector<double> seconds;
+    long peakKilobytes = 0;
+    for (int repetition = 0; repetition < repetitions; ++repetition)
+    {
+        Measure measure{};
+        if (!run(command, measure))
+        {
+            return EXIT_FAILURE;
+        }
+        seconds.push_back(measure.seconds);
+        peakKilobytes = std::max(peakKilobytes, measure.peakKilobytes);
+    }
+    std::sort(seconds.begin(), seconds.end());
+    double const minimum = seconds.front();
+    double const median = seconds[seconds.size() / 2];
+
+    long long const outputBytes = outputSize(command);
+
+    std::cout << name << ": " << minimum << " s (median " << median << " s), peak memory " << peakKilobytes / 1024
+              << " MiB";
+    if (outputBytes >= 0)
+    {
+        std::cout << ", output " << outputBytes / 1024 << " KiB";
+    }
+    std::cout << '\n';
+
+    std::ofstream json(output);
+    json << "{\n"
+         << "  \"name\": \"" << name << "\",\n"
+         << "  \"repetitions\": " << repetitions << ",\n"
+         << "  \"min_seconds\": " << minimum << ",\n"
+         << "  \"median_seconds\": " << median << ",\n"
+         << "  \"peak_memory_kilobytes\": " << peakKilobytes << ",\n"
+         << "  \"output_bytes\": " << outputBytes << "\n"
+         << "}\n";
+    return json ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,54 @@
+// Arithmetic as it used to be written, by inheriting from each of the skills it gathers, to compare the compile time
+// of both implementations. It is force-included in the generated translation units with -include.
+
+#ifndef COMPOSED_ARITHMETIC_HPP
+#define COMPOSED_ARITHMETIC_HPP
+
+#include "NamedType/named_type.hpp"
+
+template <typename T>
+struct ComposedAddable
+    : fluent::BinaryAddable<T>
+    , fluent::UnaryAddable<T>
+{
+    using fluent::BinaryAddable<T>::operator+;
+    using fluent::UnaryAddable<T>::operator+;
+};
+
+template <typename T>
+struct ComposedSubtractable
+    : fluent::BinarySubtractable<T>
+    , fluent::UnarySubtractable<T>
+{
+    using fluent::BinarySubtractable<T>::operator-;
+    using fluent::UnarySubtractable<T>::operator-;
+};
+
+template <typename T>
+struct ComposedArithmetic
+    : fluent::PreIncrementable<T>
+    , fluent::PostIncrementable<T>
+    , fluent::PreDecrementable<T>
+    , fluent::PostDecrementable<T>
+    , ComposedAddable<T>
+    , ComposedSubtractable<T>
+    , fluent::Multiplicable<T>
+    , fluent::Divisible<T>
+    , fluent::Modulable<T>
+    , fluent::BitWiseInvertable<T>
+    , fluent::BitWiseAndable<T>
+    , fluent::BitWiseOrable<T>
+    , fluent::BitWiseXorable<T>
+    , fluent::BitWiseLeftShiftable<T>
+    , fluent::BitWiseRightShiftable<T>
+    , fluent::Comparable<T>
+    , fluent::Printable<T>
+    , fluent::Hashable<T>
+{
+    using fluent::PreIncrementable<T>::operator++;
+    using fluent::PostIncrementable<T>::operator++;
+    using fluent::PreDecrementable<T>::operator--;
+    using fluent::PostDecrementable<T>::operator--;
+};
+
+#endif
@@ -0,0 +1,61 @@
+# Writes a translation unit that declares COUNT distinct strong types, and a few functions that use each of them.
+#   cmake -DCOUNT=<number of strong types> -DOUTPUT=<file> -P generate_strong_types.cmake
+# The generated code lets the benchmarks choose how the types are declared:
+#   - NAMED_TYPE_BENCH_SKILLS is the list of skills of the strong types, fluent::Arithmetic by default,
+#   - NAMED_TYPE_BENCH_RAW declares them as int instead, to give the cost of the same code without strong types,
+#   - NAMED_TYPE_BENCH_DERIVED declares them as classes derived from NamedType, instead of aliases of NamedType,
+#   - NAMED_TYPE_BENCH_IMPORT imports the fluent.named_type module instead of including the headers.
+
+if (NOT COUNT OR NOT OUTPUT)
+	message(FATAL_ERROR "usage: cmake -DCOUNT=<number of strong types> -DOUTPUT=<file> -P generate_strong_types.cmake")
+endif()
+
+set(content "// Generated by generate_strong_types.cmake, do not edit
+
+#ifdef NAMED_TYPE_BENCH_IMPORT
+import fluent.named_type;
+#else
+#    include \"NamedType/named_type.hpp\"
+#endif
+
+#ifndef NAMED_TYPE_BENCH_SKILLS
+#    define NAMED_TYPE_BENCH_SKILLS fluent::Arithmetic
+#endif
+
+#if defined(NAMED_TYPE_BENCH_RAW)
+#    define NAMED_TYPE_BENCH_STRONG_TYPE(Name) using Name = int;
+#elif defined(NAMED_TYPE_BENCH_DERIVED)
+#    define NAMED_TYPE_BENCH_STRONG_TYPE(Name) \\
+        struct Name : fluent::NamedType<int, fluent::derived<Name>, NAMED_TYPE_BENCH_SKILLS> \\
+        { \\
+            using NamedType::NamedType; \\
+        };
+#else
+#    define NAMED_TYPE_BENCH_STRONG_TYPE(Name) \\
+        using Name = fluent::NamedType<int, struct Name##Tag, NAMED_TYPE_BENCH_SKILLS>;
+#endif
+")
+
+math(EXPR last "${COUNT} - 1")
+foreach(index RANGE ${last})
+	string(APPEND content "
+NAMED_TYPE_BENCH_STRONG_TYPE(Strong${index})
+
+Strong${index} compute${index}(Strong${index} a, Strong${index} b)
+{
+    ++a;
+    a += b;
+    return a * b - a / b;
+}
+
+bool less${index}(Strong${index} a, Strong${index} b)
+{
+    return a < b;
+}
+")
+endforeach()
+
+# Only touch the file when it changes, so that the benchmarks don't rebuild more than they need
+file(WRITE "${OUTPUT}.tmp" "${content}")
+execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${OUTPUT}.tmp" "${OUTPUT}")
+file(REMOVE "${OUTPUT}.tmp")
@@ -0,0 +1,45 @@
+# Reports the sizes of the sections of an object that grow with the length of the names of its symbols.
+#   cmake -DREADELF=<readelf> -DOBJECT=<object> -DNAME=<benchmark name> -DOUTPUT=<JSON file> -P section_sizes.cmake
+
+execute_process(
+	COMMAND "${READELF}" -S -W "${OBJECT}"
+	OUTPUT_VARIABLE sectionHeaders
+	RESULT_VARIABLE result
+)
+if (NOT result EQUAL 0)
+	message(FATAL_ERROR "${READELF} failed on ${OBJECT}")
+endif()
+
+set(reportedSections ".text" ".symtab" ".strtab" ".debug_info" ".debug_str")
+foreach(section ${reportedSections})
+	set(size_${section} 0)
+endforeach()
+
+# Each section header reads: [Nr] Name Type Address Offset Size ...
+string(REPLACE "\n" ";" lines "${sectionHeaders}")
+set(total 0)
+foreach(line ${lines})
+	if (line MATCHES "\\] +([^ ]+) +[A-Za-z_0-9]+ +[0-9a-f]+ +[0-9a-f]+ +([0-9a-f]+)")
+		set(section "${CMAKE_MATCH_1}")
+		math(EXPR size "0x${CMAKE_MATCH_2}")
+		math(EXPR total "${total} + ${size}")
+		# .text is split into one section per inline function
+		if (section MATCHES "^\\.text")
+			set(section ".text")
+		endif()
+		if (DEFINED size_${section})
+			math(EXPR size_${section} "${size_${section}} + ${size}")
+		endif()
+	endif()
+endforeach()
+
+set(report "${NAME}: total ${total} bytes")
+set(json "{\n  \"name\": \"${NAME}\",\n  \"total_bytes\": ${total}")
+foreach(section ${reportedSections})
+	string(APPEND report ", ${section} ${size_${section}}")
+	string(APPEND json ",\n  \"${section}\": ${size_${section}}")
+endforeach()
+string(APPEND json "\n}\n")
+
+message(STATUS "${report}")
+file(WRITE "${OUTPUT}" "${json}")
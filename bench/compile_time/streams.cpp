@@ -0,0 +1,30 @@
+// A translation unit that uses strong types without printing them, as most translation units do.
+// NAMED_TYPE_INCLUDE_IOSTREAM adds what the core headers used to include, to measure what they no longer cost.
+
+#ifdef NAMED_TYPE_INCLUDE_IOSTREAM
+#    include <iostream>
+#endif
+
+#include "NamedType/named_type.hpp"
+
+#include <string>
+#include <unordered_set>
+
+using Meter = fluent::NamedType<double, struct MeterTag, fluent::Arithmetic>;
+using Count = fluent::NamedType<int, struct CountTag, fluent::Arithmetic>;
+using Name = fluent::NamedType<std::string, struct NameTag, fluent::Comparable, fluent::Printable, fluent::Hashable>;
+
+Meter totalLength(Meter a, Meter b)
+{
+    return a + b;
+}
+
+Count next(Count count)
+{
+    return ++count;
+}
+
+bool contains(std::unordered_set<Name> const& names, Name const& name)
+{
+    return names.find(name) != names.end();
+}
@@ -0,0 +1,129 @@
+// Counts the copies and the moves of the underlying value when building strong types in different ways, and times
+// them with an underlying type that owns memory. The copies and moves per construction are reported as counters.
+
+#include "NamedType/named_type.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+struct Payload
+{
+    Payload(std::size_t size, int value) : values(size, value)
+    {
+    }
+    Payload(std::size_t size) : values(size, 0)
+    {
+    }
+    Payload(Payload const& other) : values(other.values)
+    {
+        ++copies;
+    }
+    Payload(Payload&& other) noexcept : values(std::move(other.values))
+    {
+        ++moves;
+    }
+    Payload& operator=(Payload const&) = delete;
+    Payload& operator=(Payload&&) = delete;
+
+    std::vector<int> values;
+
+    static std::size_t copies;
+    static std::size_t moves;
+};
+
+std::size_t Payload::copies = 0;
+std::size_t Payload::moves = 0;
+
+using StrongPayload = fluent::NamedType<Payload, struct StrongPayloadTag>;
+
+template <typename T>
+using Strong = fluent::NamedType<T, struct StrongTag>;
+
+constexpr std::size_t payloadSize = 64;
+
+void reportCopiesAndMoves(benchmark::State& state)
+{
+    auto const iterations = static_cast<double>(state.iterations());
+    state.counters["copies"] = static_cast<double>(Payload::copies) / iterations;
+    state.counters["moves"] = static_cast<double>(Payload::moves) / iterations;
+    Payload::copies = 0;
+    Payload::moves = 0;
+}
+
+void fromTemporary(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        StrongPayload payload(Payload(payloadSize, 42));
+        benchmark::DoNotOptimize(payload.get().values.data());
+    }
+    reportCopiesAndMoves(state);
+}
+
+void inPlace(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        StrongPayload payload(std::in_place, payloadSize, 42);
+        benchmark::DoNotOptimize(payload.get().values.data());
+    }
+    reportCopiesAndMoves(state);
+}
+
+void makeNamedFromLvalue(benchmark::State& state)
+{
+    Payload const value(payloadSize, 42);
+    for (auto _ : state)
+    {
+        auto payload = fluent::make_named<Strong>(value);
+        benchmark::DoNotOptimize(payload.get().values.data());
+    }
+    reportCopiesAndMoves(state);
+}
+
+void makeNamedFromRvalue(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto payload = fluent::make_named<Strong>(Payload(payloadSize, 42));
+        benchmark::DoNotOptimize(payload.get().values.data());
+    }
+    reportCopiesAndMoves(state);
+}
+
+void namedArgumentFromUnderlying(benchmark::State& state)
+{
+    static const StrongPayload::argument payload;
+    for (auto _ : state)
+    {
+        auto argument = (payload = Payload(payloadSize, 42));
+        benchmark::DoNotOptimize(argument.get().values.data());
+    }
+    reportCopiesAndMoves(state);
+}
+
+void namedArgumentFromConvertible(benchmark::State& state)
+{
+    static const StrongPayload::argument payload;
+    for (auto _ : state)
+    {
+        auto argument = (payload = payloadSize);
+        benchmark::DoNotOptimize(argument.get().values.data());
+    }
+    reportCopiesAndMoves(state);
+}
+
+} // namespace
+
+BENCHMARK(fromTemporary);
+BENCHMARK(inPlace);
+BENCHMARK(makeNamedFromLvalue);
+BENCHMARK(makeNamedFromRvalue);
+BENCHMARK(namedArgumentFromUnderlying);
+BENCHMARK(namedArgumentFromConvertible);
@@ -0,0 +1,51 @@
+// Each thread increments its own counter in an array of counters, one per thread. With plain strong types, the
+// counters of several threads are on the same cache line, which the threads take turns owning. With the
+// CacheLineAligned skill, each counter is on its own cache line.
+
+#include "NamedType/named_type.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+
+using Processed = fluent::NamedType<std::uint64_t, struct ProcessedTag, fluent::PreIncrementable>;
+using AlignedProcessed =
+    fluent::NamedType<std::uint64_t, struct ProcessedTag, fluent::PreIncrementable, fluent::CacheLineAligned>;
+
+constexpr int maxThreads = 64;
+
+std::array<Processed, maxThreads> processed;
+std::array<AlignedProcessed, maxThreads> alignedProcessed;
+
+template <typename Counters>
+void incrementOwnCounter(benchmark::State& state, Counters& counters)
+{
+    auto& counter = counters[static_cast<std::size_t>(state.thread_index())];
+    for (auto _ : state)
+    {
+        ++counter;
+        // Writes the counter to memory at each iteration, as it would be if other threads read it
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void packed(benchmark::State& state)
+{
+    incrementOwnCounter(state, processed);
+}
+
+void cacheLineAligned(benchmark::State& state)
+{
+    incrementOwnCounter(state, alignedProcessed);
+}
+
+} // namespace
+
+BENCHMARK(packed)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(cacheLineAligned)->ThreadRange(1, maxThreads)->UseRealTime();
@@ -0,0 +1,144 @@
+// Looks up strong identifiers in a random order in a read-mostly table, stored in a std::map and in a StrongFlatMap,
+// and in a sorted std::vector with std::lower_bound, to compare with the branchless binary search of StrongFlatMap.
+// Also builds the tables from unsorted identifiers.
+
+#include "NamedType/named_type.hpp"
+#include "NamedType/strong_flat_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using Id = fluent::NamedType<std::uint64_t, struct IdTag, fluent::Comparable>;
+
+std::vector<Id> makeIds(std::size_t count, std::uint64_t seed)
+{
+    std::vector<Id> ids;
+    ids.reserve(count);
+    for (std::uint64_t index = 0; index < count; ++index)
+    {
+        ids.push_back(Id{index * 8});
+    }
+    std::shuffle(ids.begin(), ids.end(), std::mt19937_64(seed));
+    return ids;
+}
+
+std::vector<std::pair<Id, std::uint64_t>> makeElements(std::size_t count)
+{
+    std::vector<std::pair<Id, std::uint64_t>> elements;
+    for (auto const& id : makeIds(count, 42))
+    {
+        elements.emplace_back(id, id.get());
+    }
+    return elements;
+}
+
+void stdMapLookup(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const elements = makeElements(size);
+    std::map<Id, std::uint64_t> const map(elements.begin(), elements.end());
+    auto const ids = makeIds(size, 7);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (auto const& id : ids)
+        {
+            sum += map.find(id)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void flatMapLookup(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    fluent::StrongFlatMap<Id, std::uint64_t> const map(makeElements(size));
+    auto const ids = makeIds(size, 7);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (auto const& id : ids)
+        {
+            sum += *map.find(id);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void stdLowerBound(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto sorted = makeIds(size, 42);
+    std::sort(sorted.begin(), sorted.end());
+    auto const ids = makeIds(size, 7);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (auto const& id : ids)
+        {
+            sum += std::lower_bound(sorted.begin(), sorted.end(), id)->get();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void flatSetLowerBound(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    fluent::StrongFlatSet<Id> const set(makeIds(size, 42));
+    auto const ids = makeIds(size, 7);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (auto const& id : ids)
+        {
+            sum += set.lower_bound(id)->get();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void stdMapConstruction(benchmark::State& state)
+{
+    auto const elements = makeElements(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::map<Id, std::uint64_t> map(elements.begin(), elements.end());
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void flatMapConstruction(benchmark::State& state)
+{
+    auto const elements = makeElements(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        fluent::StrongFlatMap<Id, std::uint64_t> map(elements);
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(stdMapLookup)->Range(1 << 10, 1 << 20);
+BENCHMARK(flatMapLookup)->Range(1 << 10, 1 << 20);
+BENCHMARK(stdLowerBound)->Range(1 << 10, 1 << 20);
+BENCHMARK(flatSetLowerBound)->Range(1 << 10, 1 << 20);
+BENCHMARK(stdMapConstruction)->Range(1 << 10, 1 << 20);
+BENCHMARK(flatMapConstruction)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,185 @@
+// Inserts and looks up strong identifiers in hash tables, hashed either with std::hash (Hashable) or with
+// AvalancheHashMixer (MixedHashable). The identifiers are either consecutive, or multiples of 256 as when the low bits
+// of identifiers encode something else.
+// Besides std::unordered_map, whose prime number of buckets hides the weakness of an identity hash, the tables include
+// a minimal open addressing table with a power of two number of buckets, which only looks at the low bits of hashes.
+
+#include "NamedType/named_type.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+using HashableId = fluent::NamedType<std::uint64_t, struct HashableIdTag, fluent::Hashable, fluent::Comparable>;
+using MixedHashableId =
+    fluent::NamedType<std::uint64_t, struct MixedHashableIdTag, fluent::MixedHashable, fluent::Comparable>;
+
+template <typename Key, typename Value>
+class LinearProbingMap
+{
+public:
+    explicit LinearProbingMap(std::size_t capacity)
+        : slots_(roundUpToPowerOfTwo(capacity * 2)), mask_(slots_.size() - 1)
+    {
+    }
+
+    void insert(Key const& key, Value const& value)
+    {
+        for (auto index = std::hash<Key>()(key) & mask_;; index = (index + 1) & mask_)
+        {
+            auto& slot = slots_[index];
+            if (!slot.used || slot.key == key)
+            {
+                slot = Slot{key, value, true};
+                return;
+            }
+        }
+    }
+
+    Value const* find(Key const& key) const
+    {
+        for (auto index = std::hash<Key>()(key) & mask_;; index = (index + 1) & mask_)
+        {
+            auto const& slot = slots_[index];
+            if (!slot.used)
+            {
+                return nullptr;
+            }
+            if (slot.key == key)
+            {
+                return &slot.value;
+            }
+        }
+    }
+
+private:
+    struct Slot
+    {
+        Key key;
+        Value value;
+        bool used;
+    };
+
+    static std::size_t roundUpToPowerOfTwo(std::size_t size)
+    {
+        std::size_t powerOfTwo = 1;
+        while (powerOfTwo < size)
+        {
+            powerOfTwo *= 2;
+        }
+        return powerOfTwo;
+    }
+
+    std::vector<Slot> slots_;
+    std::size_t mask_;
+};
+
+template <typename Id>
+std::vector<Id> makeIds(std::size_t size, std::uint64_t stride)
+{
+    std::vector<Id> ids;
+    ids.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        ids.emplace_back(i * stride);
+    }
+    return ids;
+}
+
+template <typename Id>
+void unorderedMapInsert(benchmark::State& state)
+{
+    auto const ids = makeIds<Id>(static_cast<std::size_t>(state.range(0)), static_cast<std::uint64_t>(state.range(1)));
+    for (auto _ : state)
+    {
+        std::unordered_map<Id, std::uint64_t> map;
+        map.reserve(ids.size());
+        for (auto const& id : ids)
+        {
+            map.emplace(id, id.get());
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Id>
+void unorderedMapFind(benchmark::State& state)
+{
+    auto const ids = makeIds<Id>(static_cast<std::size_t>(state.range(0)), static_cast<std::uint64_t>(state.range(1)));
+    std::unordered_map<Id, std::uint64_t> map;
+    for (auto const& id : ids)
+    {
+        map.emplace(id, id.get());
+    }
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (auto const& id : ids)
+        {
+            sum += map.find(id)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Id>
+void linearProbingInsert(benchmark::State& state)
+{
+    auto const ids = makeIds<Id>(static_cast<std::size_t>(state.range(0)), static_cast<std::uint64_t>(state.range(1)));
+    for (auto _ : state)
+    {
+        LinearProbingMap<Id, std::uint64_t> map(ids.size());
+        for (auto const& id : ids)
+        {
+            map.insert(id, id.get());
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Id>
+void linearProbingFind(benchmark::State& state)
+{
+    auto const ids = makeIds<Id>(static_cast<std::size_t>(state.range(0)), static_cast<std::uint64_t>(state.range(1)));
+    LinearProbingMap<Id, std::uint64_t> map(ids.size());
+    for (auto const& id : ids)
+    {
+        map.insert(id, id.get());
+    }
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (auto const& id : ids)
+        {
+            sum += *map.find(id);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void idsAndStrides(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"ids", "stride"})->Args({1 << 16, 1})->Args({1 << 16, 256});
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(unorderedMapInsert, HashableId)->Apply(idsAndStrides);
+BENCHMARK_TEMPLATE(unorderedMapInsert, MixedHashableId)->Apply(idsAndStrides);
+BENCHMARK_TEMPLATE(unorderedMapFind, HashableId)->Apply(idsAndStrides);
+BENCHMARK_TEMPLATE(unorderedMapFind, MixedHashableId)->Apply(idsAndStrides);
+BENCHMARK_TEMPLATE(linearProbingInsert, HashableId)->Apply(idsAndStrides);
+BENCHMARK_TEMPLATE(linearProbingInsert, MixedHashableId)->Apply(idsAndStrides);
+BENCHMARK_TEMPLATE(linearProbingFind, HashableId)->Apply(idsAndStrides);
+BENCHMARK_TEMPLATE(linearProbingFind, MixedHashableId)->Apply(idsAndStrides);
@@ -0,0 +1,120 @@
+// Maps strong identifiers to a small state, in a std::unordered_map with the std::hash of Hashable, and in the two
+// tables of StrongHashMap: with a control byte per slot, and with the invalid value of the tag marking the empty slots.
+// Benchmarks building the map, and looking up present and absent identifiers in a random order.
+
+#include "NamedType/named_type.hpp"
+#include "NamedType/strong_hash_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+struct State
+{
+    std::uint32_t visits;
+    std::uint32_t flags;
+};
+
+struct InvalidIdTag
+{
+    static constexpr std::uint64_t invalid_value = 0;
+};
+
+using Id = fluent::NamedType<std::uint64_t, struct IdTag, fluent::Hashable, fluent::Comparable>;
+using IdWithInvalid = fluent::NamedType<std::uint64_t, InvalidIdTag, fluent::Hashable, fluent::Comparable>;
+
+// Identifiers from 1, spaced by 8 as when they are addresses or when their low bits encode something else, in an
+// order given by the seed
+template <typename Key>
+std::vector<Key> makeKeys(std::size_t count, std::uint64_t offset, std::uint64_t seed)
+{
+    std::vector<Key> keys;
+    keys.reserve(count);
+    for (std::uint64_t index = 0; index < count; ++index)
+    {
+        keys.push_back(Key{1 + offset + index * 8});
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(seed));
+    return keys;
+}
+
+using UnorderedMap = std::unordered_map<Id, State>;
+using ControlByteMap = fluent::StrongHashMap<Id, State>;
+using InvalidKeyMap = fluent::StrongHashMap<IdWithInvalid, State>;
+
+State* find(UnorderedMap& map, Id const& key)
+{
+    auto const it = map.find(key);
+    return it == map.end() ? nullptr : &it->second;
+}
+
+template <typename Map, typename Key>
+State* find(Map& map, Key const& key)
+{
+    return map.find(key);
+}
+
+template <typename Map, typename Key>
+void insert(benchmark::State& state)
+{
+    auto const keys = makeKeys<Key>(static_cast<std::size_t>(state.range(0)), 0, 42);
+    for (auto _ : state)
+    {
+        Map map;
+        for (auto const& key : keys)
+        {
+            map[key].visits = 1;
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Looks up present identifiers, or absent ones that fall between them
+template <typename Map, typename Key, std::uint64_t Offset>
+void lookup(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    Map map;
+    for (auto const& key : makeKeys<Key>(size, 0, 42))
+    {
+        map[key].visits = 1;
+    }
+    // Not in the order of insertion, in which std::unordered_map allocated its nodes
+    auto const keys = makeKeys<Key>(size, Offset, 7);
+    for (auto _ : state)
+    {
+        std::uint32_t visits = 0;
+        for (auto const& key : keys)
+        {
+            if (State const* found = find(map, key))
+            {
+                visits += found->visits;
+            }
+        }
+        benchmark::DoNotOptimize(visits);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(insert, UnorderedMap, Id)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(insert, ControlByteMap, Id)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(insert, InvalidKeyMap, IdWithInvalid)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_TEMPLATE(lookup, UnorderedMap, Id, 0)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(lookup, ControlByteMap, Id, 0)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(lookup, InvalidKeyMap, IdWithInvalid, 0)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_TEMPLATE(lookup, UnorderedMap, Id, 4)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(lookup, ControlByteMap, Id, 4)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(lookup, InvalidKeyMap, IdWithInvalid, 4)->Range(1 << 10, 1 << 22);
@@ -0,0 +1,118 @@
+// Counts the copies and the moves of the arguments of a function called with named arguments in any order, and times
+// the call with arguments that own memory. The copies and moves per call are reported as counters.
+// The "byValueTuple" cases reproduce the former dispatch, that stored the arguments in a tuple of values.
+
+#include "NamedType/named_type.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace
+{
+
+struct Payload
+{
+    explicit Payload(char c) : text(64, c)
+    {
+    }
+    Payload(Payload const& other) : text(other.text)
+    {
+        ++copies;
+    }
+    Payload(Payload&& other) noexcept : text(std::move(other.text))
+    {
+        ++moves;
+    }
+    Payload& operator=(Payload const&) = delete;
+    Payload& operator=(Payload&&) = delete;
+
+    std::string text;
+
+    static std::size_t copies;
+    static std::size_t moves;
+};
+
+std::size_t Payload::copies = 0;
+std::size_t Payload::moves = 0;
+
+using FirstName = fluent::NamedType<Payload, struct FirstNameTag>;
+using LastName = fluent::NamedType<Payload, struct LastNameTag>;
+
+void reportCopiesAndMoves(benchmark::State& state)
+{
+    auto const iterations = static_cast<double>(state.iterations());
+    state.counters["copies"] = static_cast<double>(Payload::copies) / iterations;
+    state.counters["moves"] = static_cast<double>(Payload::moves) / iterations;
+    Payload::copies = 0;
+    Payload::moves = 0;
+}
+
+std::size_t fullNameLength(FirstName const& firstName, LastName const& lastName)
+{
+    return firstName.get().text.size() + lastName.get().text.size();
+}
+
+template <class F, class... Ts>
+struct ByValueTupleCallable
+{
+    F f;
+    template <class... Us>
+    auto operator()(Us&&... args) const
+    {
+        auto x = std::make_tuple(std::forward<Us>(args)...);
+        return f(std::move(std::get<Ts>(x))...);
+    }
+};
+
+auto const namedArguments = fluent::make_named_arg_function<FirstName, LastName>(&fullNameLength);
+auto const byValueTuple = ByValueTupleCallable<decltype(&fullNameLength), FirstName, LastName>{&fullNameLength};
+
+void directCall(benchmark::State& state)
+{
+    FirstName const firstName(Payload('a'));
+    LastName const lastName(Payload('b'));
+    Payload::moves = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fullNameLength(firstName, lastName));
+    }
+    reportCopiesAndMoves(state);
+}
+
+template <typename Callable>
+void lvalueArguments(benchmark::State& state, Callable const& callable)
+{
+    FirstName const firstName(Payload('a'));
+    LastName const lastName(Payload('b'));
+    Payload::moves = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(callable(lastName, firstName));
+    }
+    reportCopiesAndMoves(state);
+}
+
+template <typename Callable>
+void rvalueArguments(benchmark::State& state, Callable const& callable)
+{
+    FirstName firstName(Payload('a'));
+    LastName lastName(Payload('b'));
+    Payload::moves = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(callable(std::move(lastName), std::move(firstName)));
+    }
+    reportCopiesAndMoves(state);
+}
+
+} // namespace
+
+BENCHMARK(directCall);
+BENCHMARK_CAPTURE(lvalueArguments, namedArguments, namedArguments);
+BENCHMARK_CAPTURE(lvalueArguments, byValueTuple, byValueTuple);
+BENCHMARK_CAPTURE(rvalueArguments, namedArguments, namedArguments);
+BENCHMARK_CAPTURE(rvalueArguments, byValueTuple, byValueTuple);
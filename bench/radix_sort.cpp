@@ -0,0 +1,144 @@
+// Sorts strong identifiers and timestamps with std::sort and the operator< of Comparable, and with radix_sort, from
+// thousands to millions of values: random 64-bit identifiers, signed timestamps within a day, doubles, and records
+// sorted by their timestamp.
+
+#include "NamedType/named_type.hpp"
+#include "NamedType/radix_sort.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using Id = fluent::NamedType<std::uint64_t, struct IdTag, fluent::Comparable>;
+using Timestamp = fluent::NamedType<std::int64_t, struct TimestampTag, fluent::Comparable>;
+using Price = fluent::NamedType<double, struct PriceTag, fluent::Comparable>;
+
+struct Event
+{
+    Timestamp timestamp;
+    std::uint64_t payload;
+};
+
+std::vector<Id> makeIds(std::size_t size)
+{
+    std::mt19937_64 random(42);
+    std::vector<Id> ids;
+    ids.reserve(size);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        ids.push_back(Id{random()});
+    }
+    return ids;
+}
+
+// Microseconds around an epoch, that only differ by their 5 lowest bytes
+std::vector<Timestamp> makeTimestamps(std::size_t size)
+{
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<std::int64_t> offset(-43'200'000'000, 43'200'000'000);
+    std::vector<Timestamp> timestamps;
+    timestamps.reserve(size);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        timestamps.push_back(Timestamp{1'700'000'000'000'000 + offset(random)});
+    }
+    return timestamps;
+}
+
+std::vector<Price> makePrices(std::size_t size)
+{
+    std::mt19937_64 random(42);
+    std::normal_distribution<double> price(0, 1000);
+    std::vector<Price> prices;
+    prices.reserve(size);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        prices.push_back(Price{price(random)});
+    }
+    return prices;
+}
+
+std::vector<Event> makeEvents(std::size_t size)
+{
+    std::vector<Event> events;
+    events.reserve(size);
+    std::uint64_t payload = 0;
+    for (auto const& timestamp : makeTimestamps(size))
+    {
+        events.push_back(Event{timestamp, payload++});
+    }
+    return events;
+}
+
+template <typename T>
+struct StdSort
+{
+    static void sort(std::vector<T>& values)
+    {
+        std::sort(values.begin(), values.end());
+    }
+};
+
+template <>
+struct StdSort<Event>
+{
+    static void sort(std::vector<Event>& events)
+    {
+        std::sort(events.begin(), events.end(),
+                  [](Event const& lhs, Event const& rhs) { return lhs.timestamp < rhs.timestamp; });
+    }
+};
+
+template <typename T>
+struct RadixSort
+{
+    static void sort(std::vector<T>& values)
+    {
+        fluent::radix_sort(values.begin(), values.end());
+    }
+};
+
+template <>
+struct RadixSort<Event>
+{
+    static void sort(std::vector<Event>& events)
+    {
+        fluent::radix_sort(events.begin(), events.end(), [](Event const& event) { return event.timestamp; });
+    }
+};
+
+template <typename T, std::vector<T> (*Make)(std::size_t), template <typename> class Sort>
+void sort(benchmark::State& state)
+{
+    auto const values = Make(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto sorted = values;
+        state.ResumeTiming();
+        Sort<T>::sort(sorted);
+        benchmark::DoNotOptimize(sorted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(sort, Id, makeIds, StdSort)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(sort, Id, makeIds, RadixSort)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(sort, Timestamp, makeTimestamps, StdSort)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(sort, Timestamp, makeTimestamps, RadixSort)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(sort, Price, makePrices, StdSort)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(sort, Price, makePrices, RadixSort)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(sort, Event, makeEvents, StdSort)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(sort, Event, makeEvents, RadixSort)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,64 @@
+// Adds to a counter from an increasing number of threads, with fetch_add on a single fluent::atomic, which all the
+// threads write to, and with += on a Sharded accumulator, where each thread writes to its own cache line.
+// Reading the total is a single load for the atomic, and a sum over the shards for the Sharded accumulator.
+
+#include "NamedType/atomic.hpp"
+#include "NamedType/named_type.hpp"
+#include "NamedType/sharded.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+
+using Requests = fluent::NamedType<std::uint64_t, struct RequestsTag, fluent::Addable>;
+
+// Enough shards for the largest number of threads of the benchmarks
+constexpr std::size_t maxThreads = 64;
+
+fluent::atomic<Requests> atomicRequests;
+fluent::Sharded<Requests> shardedRequests(maxThreads);
+
+void atomicAdd(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        atomicRequests.fetch_add(Requests{1}, std::memory_order_relaxed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void shardedAdd(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        shardedRequests += Requests{1};
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void atomicLoad(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(atomicRequests.load(std::memory_order_relaxed));
+    }
+}
+
+void shardedLoad(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(shardedRequests.load());
+    }
+}
+
+} // namespace
+
+BENCHMARK(atomicAdd)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(shardedAdd)->ThreadRange(1, maxThreads)->UseRealTime();
+BENCHMARK(atomicLoad);
+BENCHMARK(shardedLoad);
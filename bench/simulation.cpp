@@ -0,0 +1,100 @@
+// A simulation loop written once with raw types and once with strong types.
+// Built with and without FLUENT_FORCE_INLINE, it shows how much of the cost of strong types in unoptimized builds
+// comes from the calls to their accessors and skills.
+
+#include "NamedType/named_type.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+
+using Position = fluent::
+    NamedType<double, struct PositionTag, fluent::Addable, fluent::Subtractable, fluent::Multiplicable, fluent::Comparable>;
+using Collisions = fluent::NamedType<long, struct CollisionsTag, fluent::PreIncrementable, fluent::Addable>;
+
+struct RawParticles
+{
+    std::vector<double> positions;
+    std::vector<double> speeds;
+};
+
+struct StrongParticles
+{
+    std::vector<Position> positions;
+    std::vector<Position> speeds;
+};
+
+template <typename Particles>
+Particles makeParticles(std::size_t size)
+{
+    Particles particles;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        particles.positions.emplace_back(static_cast<double>(i % 100));
+        particles.speeds.emplace_back(static_cast<double>(i % 7) - 3.);
+    }
+    return particles;
+}
+
+long step(RawParticles& particles, double timeStep, double wall)
+{
+    long collisions = 0;
+    for (std::size_t i = 0; i < particles.positions.size(); ++i)
+    {
+        particles.positions[i] += particles.speeds[i] * timeStep;
+        if (wall < particles.positions[i] || particles.positions[i] < -wall)
+        {
+            particles.speeds[i] = -particles.speeds[i];
+            ++collisions;
+        }
+    }
+    return collisions;
+}
+
+Collisions step(StrongParticles& particles, Position timeStep, Position wall)
+{
+    Collisions collisions{0};
+    for (std::size_t i = 0; i < particles.positions.size(); ++i)
+    {
+        particles.positions[i] += particles.speeds[i] * timeStep;
+        if (wall < particles.positions[i] || particles.positions[i] < -wall)
+        {
+            particles.speeds[i] = -particles.speeds[i];
+            ++collisions;
+        }
+    }
+    return collisions;
+}
+
+void rawSimulation(benchmark::State& state)
+{
+    auto particles = makeParticles<RawParticles>(static_cast<std::size_t>(state.range(0)));
+    long collisions = 0;
+    for (auto _ : state)
+    {
+        collisions += step(particles, 0.01, 100.);
+    }
+    benchmark::DoNotOptimize(collisions);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void strongSimulation(benchmark::State& state)
+{
+    auto particles = makeParticles<StrongParticles>(static_cast<std::size_t>(state.range(0)));
+    Collisions collisions{0};
+    for (auto _ : state)
+    {
+        collisions += step(particles, Position(0.01), Position(100.));
+    }
+    benchmark::DoNotOptimize(collisions.get());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(rawSimulation)->Arg(1 << 16);
+BENCHMARK(strongSimulation)->Arg(1 << 16);
@@ -0,0 +1,457 @@
+// Compares every skill of underlying_functionalities.hpp with the same operation on the raw underlying type.
+// Each benchmark is registered twice, once for the raw type and once for the strong type, so that their
+// results sit next to each other in the output.
+
+#include "NamedType/named_type.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using StrongInt = fluent::NamedType<int, struct StrongIntTag, fluent::Arithmetic>;
+using StrongDouble = fluent::NamedType<double, struct StrongDoubleTag, fluent::Arithmetic>;
+using StrongString = fluent::NamedType<
+    std::string,
+    struct StrongStringTag,
+    fluent::BinaryAddable,
+    fluent::Comparable,
+    fluent::Printable,
+    fluent::Hashable,
+    fluent::MethodCallable>;
+using ConvertibleInt = fluent::NamedType<int, struct ConvertibleIntTag, fluent::ImplicitlyConvertibleTo<long>::templ>;
+using CallableInt = fluent::NamedType<int, struct CallableIntTag, fluent::FunctionCallable>;
+
+// Values
+
+template <typename T>
+struct Underlying
+{
+    using type = T;
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct Underlying<fluent::NamedType<T, Parameter, Skills...>>
+{
+    using type = T;
+};
+
+template <typename T>
+T makeUnderlying(std::size_t i, std::size_t size)
+{
+    return static_cast<T>(i * 7919 % size + 1);
+}
+
+template <>
+std::string makeUnderlying<std::string>(std::size_t i, std::size_t size)
+{
+    return "identifier-" + std::to_string(i * 7919 % size);
+}
+
+// The right-hand side values stay small so that they can be used as divisors and shift amounts
+template <typename T>
+std::vector<T> makeValues(std::size_t size, std::size_t modulo)
+{
+    std::vector<T> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        values.emplace_back(makeUnderlying<typename Underlying<T>::type>(i, modulo));
+    }
+    return values;
+}
+
+void sizes(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->Arg(1 << 10)->Arg(1 << 20);
+}
+
+// Operations
+
+struct PreIncrement
+{
+    template <typename T>
+    void operator()(T& value) const
+    {
+        ++value;
+    }
+};
+
+struct PostIncrement
+{
+    template <typename T>
+    void operator()(T& value) const
+    {
+        value++;
+    }
+};
+
+struct PreDecrement
+{
+    template <typename T>
+    void operator()(T& value) const
+    {
+        --value;
+    }
+};
+
+struct PostDecrement
+{
+    template <typename T>
+    void operator()(T& value) const
+    {
+        value--;
+    }
+};
+
+struct UnaryPlus
+{
+    template <typename T>
+    T operator()(T const& value) const
+    {
+        return +value;
+    }
+};
+
+struct Negate
+{
+    template <typename T>
+    T operator()(T const& value) const
+    {
+        return -value;
+    }
+};
+
+struct BitWiseInvert
+{
+    template <typename T>
+    T operator()(T const& value) const
+    {
+        return ~value;
+    }
+};
+
+#define NAMED_TYPE_BENCH_BINARY_OPERATION(name, op)                                                                    \
+    struct name                                                                                                        \
+    {                                                                                                                  \
+        template <typename T>                                                                                          \
+        T operator()(T const& lhs, T const& rhs) const                                                                 \
+        {                                                                                                              \
+            return lhs op rhs;                                                                                         \
+        }                                                                                                              \
+    };                                                                                                                 \
+    struct name##Assign                                                                                                \
+    {                                                                                                                  \
+        template <typename T>                                                                                          \
+        T operator()(T lhs, T const& rhs) const                                                                        \
+        {                                                                                                              \
+            lhs op##= rhs;                                                                                             \
+            return lhs;                                                                                                \
+        }                                                                                                              \
+    };
+
+NAMED_TYPE_BENCH_BINARY_OPERATION(Plus, +)
+NAMED_TYPE_BENCH_BINARY_OPERATION(Minus, -)
+NAMED_TYPE_BENCH_BINARY_OPERATION(Multiplies, *)
+NAMED_TYPE_BENCH_BINARY_OPERATION(Divides, /)
+NAMED_TYPE_BENCH_BINARY_OPERATION(Modulus, %)
+NAMED_TYPE_BENCH_BINARY_OPERATION(BitWiseAnd, &)
+NAMED_TYPE_BENCH_BINARY_OPERATION(BitWiseOr, |)
+NAMED_TYPE_BENCH_BINARY_OPERATION(BitWiseXor, ^)
+NAMED_TYPE_BENCH_BINARY_OPERATION(LeftShift, <<)
+NAMED_TYPE_BENCH_BINARY_OPERATION(RightShift, >>)
+
+#undef NAMED_TYPE_BENCH_BINARY_OPERATION
+
+struct Less
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+struct Greater
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs > rhs;
+    }
+};
+
+struct LessOrEqual
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs <= rhs;
+    }
+};
+
+struct GreaterOrEqual
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs >= rhs;
+    }
+};
+
+struct Equal
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs == rhs;
+    }
+};
+
+struct NotEqual
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs != rhs;
+    }
+};
+
+long takeLong(long value)
+{
+    return value;
+}
+
+int takeIntReference(int const& value)
+{
+    return value;
+}
+
+struct ConvertToLong
+{
+    template <typename T>
+    long operator()(T const& value) const
+    {
+        return takeLong(value);
+    }
+};
+
+struct CallFunction
+{
+    template <typename T>
+    long operator()(T const& value) const
+    {
+        return takeIntReference(value);
+    }
+};
+
+struct CallMethod
+{
+    long operator()(std::string const& value) const
+    {
+        return static_cast<long>(value.size());
+    }
+    template <typename T>
+    long operator()(T const& value) const
+    {
+        return static_cast<long>(value->size());
+    }
+};
+
+struct Hash
+{
+    template <typename T>
+    long operator()(T const& value) const
+    {
+        return static_cast<long>(std::hash<T>()(value));
+    }
+};
+
+// Benchmarks
+
+template <typename T, typename Operation>
+void inPlace(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto values = makeValues<T>(size, size);
+    for (auto _ : state)
+    {
+        for (auto& value : values)
+        {
+            Operation()(value);
+        }
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T, typename Operation>
+void unary(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const values = makeValues<T>(size, size);
+    auto results = values;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            results[i] = Operation()(values[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T, typename Operation>
+void binary(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const lhs = makeValues<T>(size, size);
+    auto const rhs = makeValues<T>(size, 7);
+    auto results = lhs;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            results[i] = Operation()(lhs[i], rhs[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T, typename Operation>
+void compare(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const lhs = makeValues<T>(size, size);
+    auto const rhs = makeValues<T>(size, size / 2 + 1);
+    for (auto _ : state)
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            count += Operation()(lhs[i], rhs[i]) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T, typename Operation>
+void accumulate(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const values = makeValues<T>(size, size);
+    for (auto _ : state)
+    {
+        long sum = 0;
+        for (auto const& value : values)
+        {
+            sum += Operation()(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void print(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const values = makeValues<T>(size, size);
+    for (auto _ : state)
+    {
+        std::ostringstream os;
+        for (auto const& value : values)
+        {
+            os << value;
+        }
+        benchmark::DoNotOptimize(os);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+#define NAMED_TYPE_BENCHMARK(benchmark, raw, strong, ...)                                                              \
+    BENCHMARK_TEMPLATE(benchmark, raw, ##__VA_ARGS__)->Apply(sizes);                                                   \
+    BENCHMARK_TEMPLATE(benchmark, strong, ##__VA_ARGS__)->Apply(sizes)
+
+// PreIncrementable, PostIncrementable, PreDecrementable, PostDecrementable
+NAMED_TYPE_BENCHMARK(inPlace, int, StrongInt, PreIncrement);
+NAMED_TYPE_BENCHMARK(inPlace, int, StrongInt, PostIncrement);
+NAMED_TYPE_BENCHMARK(inPlace, int, StrongInt, PreDecrement);
+NAMED_TYPE_BENCHMARK(inPlace, int, StrongInt, PostDecrement);
+NAMED_TYPE_BENCHMARK(inPlace, double, StrongDouble, PreIncrement);
+NAMED_TYPE_BENCHMARK(inPlace, double, StrongDouble, PostDecrement);
+
+// Addable, Subtractable
+NAMED_TYPE_BENCHMARK(unary, int, StrongInt, UnaryPlus);
+NAMED_TYPE_BENCHMARK(unary, int, StrongInt, Negate);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, Plus);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, PlusAssign);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, Minus);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, MinusAssign);
+NAMED_TYPE_BENCHMARK(unary, double, StrongDouble, Negate);
+NAMED_TYPE_BENCHMARK(binary, double, StrongDouble, Plus);
+NAMED_TYPE_BENCHMARK(binary, double, StrongDouble, MinusAssign);
+NAMED_TYPE_BENCHMARK(binary, std::string, StrongString, Plus);
+NAMED_TYPE_BENCHMARK(binary, std::string, StrongString, PlusAssign);
+
+// Multiplicable, Divisible, Modulable
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, Multiplies);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, MultipliesAssign);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, Divides);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, DividesAssign);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, Modulus);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, ModulusAssign);
+NAMED_TYPE_BENCHMARK(binary, double, StrongDouble, Multiplies);
+NAMED_TYPE_BENCHMARK(binary, double, StrongDouble, Divides);
+
+// BitWiseInvertable, BitWiseAndable, BitWiseOrable, BitWiseXorable, BitWiseLeftShiftable, BitWiseRightShiftable
+NAMED_TYPE_BENCHMARK(unary, int, StrongInt, BitWiseInvert);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, BitWiseAnd);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, BitWiseAndAssign);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, BitWiseOr);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, BitWiseOrAssign);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, BitWiseXor);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, BitWiseXorAssign);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, LeftShift);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, LeftShiftAssign);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, RightShift);
+NAMED_TYPE_BENCHMARK(binary, int, StrongInt, RightShiftAssign);
+
+// Comparable
+NAMED_TYPE_BENCHMARK(compare, int, StrongInt, Less);
+NAMED_TYPE_BENCHMARK(compare, int, StrongInt, Greater);
+NAMED_TYPE_BENCHMARK(compare, int, StrongInt, LessOrEqual);
+NAMED_TYPE_BENCHMARK(compare, int, StrongInt, GreaterOrEqual);
+NAMED_TYPE_BENCHMARK(compare, int, StrongInt, Equal);
+NAMED_TYPE_BENCHMARK(compare, int, StrongInt, NotEqual);
+NAMED_TYPE_BENCHMARK(compare, double, StrongDouble, Less);
+NAMED_TYPE_BENCHMARK(compare, std::string, StrongString, Less);
+NAMED_TYPE_BENCHMARK(compare, std::string, StrongString, Equal);
+
+// Hashable
+NAMED_TYPE_BENCHMARK(accumulate, int, StrongInt, Hash);
+NAMED_TYPE_BENCHMARK(accumulate, std::string, StrongString, Hash);
+
+// Printable
+NAMED_TYPE_BENCHMARK(print, int, StrongInt);
+NAMED_TYPE_BENCHMARK(print, double, StrongDouble);
+NAMED_TYPE_BENCHMARK(print, std::string, StrongString);
+
+// ImplicitlyConvertibleTo, FunctionCallable, MethodCallable
+NAMED_TYPE_BENCHMARK(accumulate, int, ConvertibleInt, ConvertToLong);
+NAMED_TYPE_BENCHMARK(accumulate, int, CallableInt, CallFunction);
+NAMED_TYPE_BENCHMARK(accumulate, std::string, StrongString, CallMethod);
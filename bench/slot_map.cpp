@@ -0,0 +1,172 @@
+// Stores entities designated by strong identifiers, in a std::unordered_map keyed by a Hashable strong type and in a
+// SlotMap whose handles are the strong type. Benchmarks looking up entities in a random order, visiting all of them,
+// and erasing and inserting entities as they are destroyed and created.
+
+#include "NamedType/named_type.hpp"
+#include "NamedType/slot_map.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+struct Entity
+{
+    double x;
+    double y;
+    double z;
+    std::uint64_t flags;
+};
+
+using EntityId = fluent::NamedType<std::uint64_t, struct EntityTag, fluent::Hashable, fluent::Comparable>;
+using EntityMap = std::unordered_map<EntityId, Entity>;
+using EntitySlotMap = fluent::SlotMap<struct EntityTag, Entity, fluent::Hashable, fluent::Comparable>;
+
+Entity makeEntity(std::size_t index)
+{
+    auto const position = static_cast<double>(index);
+    return Entity{position, position, position, index};
+}
+
+struct MapFixture
+{
+    explicit MapFixture(std::size_t size) : entities(), ids()
+    {
+        entities.reserve(size);
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            EntityId const id{index};
+            entities.emplace(id, makeEntity(index));
+            ids.push_back(id);
+        }
+        std::shuffle(ids.begin(), ids.end(), std::mt19937_64(42));
+    }
+
+    EntityMap entities;
+    std::vector<EntityId> ids;
+};
+
+struct SlotMapFixture
+{
+    explicit SlotMapFixture(std::size_t size) : entities(), ids()
+    {
+        entities.reserve(size);
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            ids.push_back(entities.insert(makeEntity(index)));
+        }
+        std::shuffle(ids.begin(), ids.end(), std::mt19937_64(42));
+    }
+
+    EntitySlotMap entities;
+    std::vector<EntityId> ids;
+};
+
+void unorderedMapLookup(benchmark::State& state)
+{
+    MapFixture fixture(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (auto const& id : fixture.ids)
+        {
+            sum += fixture.entities.find(id)->second.x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void slotMapLookup(benchmark::State& state)
+{
+    SlotMapFixture fixture(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (auto const& id : fixture.ids)
+        {
+            sum += fixture.entities.find(id)->x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void unorderedMapIteration(benchmark::State& state)
+{
+    MapFixture fixture(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (auto const& entity : fixture.entities)
+        {
+            sum += entity.second.x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void slotMapIteration(benchmark::State& state)
+{
+    SlotMapFixture fixture(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (auto const& entity : fixture.entities)
+        {
+            sum += entity.x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Destroys an entity and creates another one, as many times as there are entities
+void unorderedMapChurn(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    MapFixture fixture(size);
+    std::uint64_t nextId = size;
+    for (auto _ : state)
+    {
+        for (auto& id : fixture.ids)
+        {
+            fixture.entities.erase(id);
+            id = EntityId{nextId++};
+            fixture.entities.emplace(id, makeEntity(size));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void slotMapChurn(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    SlotMapFixture fixture(size);
+    for (auto _ : state)
+    {
+        for (auto& id : fixture.ids)
+        {
+            fixture.entities.erase(id);
+            id = fixture.entities.insert(makeEntity(size));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(unorderedMapLookup)->Range(1 << 10, 1 << 20);
+BENCHMARK(slotMapLookup)->Range(1 << 10, 1 << 20);
+BENCHMARK(unorderedMapIteration)->Range(1 << 10, 1 << 20);
+BENCHMARK(slotMapIteration)->Range(1 << 10, 1 << 20);
+BENCHMARK(unorderedMapChurn)->Range(1 << 10, 1 << 20);
+BENCHMARK(slotMapChurn)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,163 @@
+#ifndef ATOMIC_HPP
+#define ATOMIC_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+namespace fluent
+{
+
+namespace details
+{
+template <typename Strong>
+using AddAssignment = decltype(std::declval<Strong&>() += std::declval<Strong const&>());
+template <typename Strong>
+using SubtractAssignment = decltype(std::declval<Strong&>() -= std::declval<Strong const&>());
+template <typename Strong>
+using AndAssignment = decltype(std::declval<Strong&>() &= std::declval<Strong const&>());
+template <typename Strong>
+using OrAssignment = decltype(std::declval<Strong&>() |= std::declval<Strong const&>());
+template <typename Strong>
+using XorAssignment = decltype(std::declval<Strong&>() ^= std::declval<Strong const&>());
+
+// Whether the strong type has the skill of an operation
+template <template <typename> class Operation, typename Strong, typename = void>
+struct HasOperation : std::false_type
+{
+};
+
+template <template <typename> class Operation, typename Strong>
+struct HasOperation<Operation, Strong, typename make_void<Operation<Strong>>::type> : std::true_type
+{
+};
+} // namespace details
+
+// A strong type that can be read and modified from several threads at once, with the interface of std::atomic:
+//   using BytesSent = NamedType<std::int64_t, struct BytesSentTag, Addable>;
+//   atomic<BytesSent> bytesSent;
+//   bytesSent.fetch_add(BytesSent{1024}, std::memory_order_relaxed);
+//   BytesSent const total = bytesSent.load();
+// The values go in and out as the strong type, and the read-modify-write operations are only available when the
+// strong type has the skill of the operation they perform: fetch_add needs Addable, fetch_and needs BitWiseAndable...
+template <typename Strong>
+class atomic
+{
+public:
+    using value_type = Strong;
+    using underlying_type = typename Strong::UnderlyingType;
+
+    static_assert(!std::is_reference<underlying_type>::value, "atomic can't hold a strong reference");
+
+#if defined(__cpp_lib_atomic_is_always_lock_free)
+    static constexpr bool is_always_lock_free = std::atomic<underlying_type>::is_always_lock_free;
+#endif
+
+    FLUENT_INLINE constexpr atomic() noexcept(std::is_nothrow_default_constructible<underlying_type>::value)
+        : value_(underlying_type())
+    {
+    }
+
+    FLUENT_INLINE constexpr atomic(Strong const& desired) noexcept : value_(desired.get())
+    {
+    }
+
+    atomic(atomic const&) = delete;
+    atomic& operator=(atomic const&) = delete;
+
+    FLUENT_INLINE bool is_lock_free() const noexcept
+    {
+        return value_.is_lock_free();
+    }
+
+    FLUENT_INLINE void store(Strong const& desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        value_.store(desired.get(), order);
+    }
+
+    FLUENT_INLINE Strong load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return Strong(value_.load(order));
+    }
+
+    FLUENT_INLINE Strong exchange(Strong const& desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return Strong(value_.exchange(desired.get(), order));
+    }
+
+    FLUENT_INLINE bool compare_exchange_weak(Strong& expected,
+                                             Strong const& desired,
+                                             std::memory_order success,
+                                             std::memory_order failure) noexcept
+    {
+        return value_.compare_exchange_weak(expected.get(), desired.get(), success, failure);
+    }
+
+    FLUENT_INLINE bool compare_exchange_weak(Strong& expected,
+                                             Strong const& desired,
+                                             std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return value_.compare_exchange_weak(expected.get(), desired.get(), order);
+    }
+
+    FLUENT_INLINE bool compare_exchange_strong(Strong& expected,
+                                               Strong const& desired,
+                                               std::memory_order success,
+                                               std::memory_order failure) noexcept
+    {
+        return value_.compare_exchange_strong(expected.get(), desired.get(), success, failure);
+    }
+
+    FLUENT_INLINE bool compare_exchange_strong(Strong& expected,
+                                               Strong const& desired,
+                                               std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return value_.compare_exchange_strong(expected.get(), desired.get(), order);
+    }
+
+    // The read-modify-write operations return the value held before the operation
+    FLUENT_INLINE Strong fetch_add(Strong const& arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        static_assert(details::HasOperation<details::AddAssignment, Strong>::value,
+                      "fetch_add needs a strong type with the Addable skill");
+        return Strong(value_.fetch_add(arg.get(), order));
+    }
+
+    FLUENT_INLINE Strong fetch_sub(Strong const& arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        static_assert(details::HasOperation<details::SubtractAssignment, Strong>::value,
+                      "fetch_sub needs a strong type with the Subtractable skill");
+        return Strong(value_.fetch_sub(arg.get(), order));
+    }
+
+    FLUENT_INLINE Strong fetch_and(Strong const& arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        static_assert(details::HasOperation<details::AndAssignment, Strong>::value,
+                      "fetch_and needs a strong type with the BitWiseAndable skill");
+        return Strong(value_.fetch_and(arg.get(), order));
+    }
+
+    FLUENT_INLINE Strong fetch_or(Strong const& arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        static_assert(details::HasOperation<details::OrAssignment, Strong>::value,
+                      "fetch_or needs a strong type with the BitWiseOrable skill");
+        return Strong(value_.fetch_or(arg.get(), order));
+    }
+
+    FLUENT_INLINE Strong fetch_xor(Strong const& arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        static_assert(details::HasOperation<details::XorAssignment, Strong>::value,
+                      "fetch_xor needs a strong type with the BitWiseXorable skill");
+        return Strong(value_.fetch_xor(arg.get(), order));
+    }
+
+private:
+    std::atomic<underlying_type> value_;
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef CACHE_LINE_HPP
+#define CACHE_LINE_HPP
+
+#include "crtp.hpp"
+
+#include <cstddef>
+#include <new>
+
+// The distance that keeps two objects written by different threads from sharing a cache line, and from slowing each
+// other down by false sharing. It can be set with FLUENT_CACHE_LINE_SIZE.
+// std::hardware_destructive_interference_size is only used with MSVC: GCC and Clang make it depend on the target
+// options, which would make the layout of the types that use it differ between translation units.
+#ifndef FLUENT_CACHE_LINE_SIZE
+#    if defined(_MSC_VER) && !defined(__clang__) && defined(__cpp_lib_hardware_interference_size)
+#        define FLUENT_CACHE_LINE_SIZE std::hardware_destructive_interference_size
+#    elif (defined(__APPLE__) && defined(__aarch64__)) || defined(__powerpc64__)
+#        define FLUENT_CACHE_LINE_SIZE 128
+#    else
+#        define FLUENT_CACHE_LINE_SIZE 64
+#    endif
+#endif
+
+namespace fluent
+{
+
+constexpr std::size_t cache_line_size = FLUENT_CACHE_LINE_SIZE;
+
+// A skill that aligns the strong type on a cache line, and pads its size to a multiple of it, so that the strong
+// types of an array, such as the state of each worker thread, are not on the same cache line:
+//   using Processed = NamedType<std::uint64_t, struct ProcessedTag, PreIncrementable, CacheLineAligned>;
+//   std::array<Processed, workers> processed; // each worker increments its own without slowing down the others
+// The strong type keeps its other skills and its accessors. Allocating it on the heap needs C++17, since earlier
+// operator new doesn't know about alignments larger than the one of std::max_align_t.
+template <typename T>
+struct alignas(cache_line_size) CacheLineAligned : crtp<T, CacheLineAligned>
+{
+};
+
+} // namespace fluent
+
+#endif
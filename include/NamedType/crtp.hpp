@@ -1,17 +1,38 @@
 #ifndef CRTP_HPP
 #define CRTP_HPP
 
+// Define FLUENT_FORCE_INLINE to have the accessors and the skills of strong types inlined even in unoptimized builds,
+// where each of them is otherwise a function call. They are also marked artificial so that debuggers step over them.
+#if defined(FLUENT_FORCE_INLINE)
+#    if defined(__clang__) || defined(__GNUC__)
+#        if defined(__has_attribute)
+#            if __has_attribute(artificial)
+#                define FLUENT_INLINE __attribute__((always_inline, artificial)) inline
+#            endif
+#        endif
+#        if !defined(FLUENT_INLINE)
+#            define FLUENT_INLINE __attribute__((always_inline)) inline
+#        endif
+#    elif defined(_MSC_VER)
+#        define FLUENT_INLINE __forceinline
+#    else
+#        define FLUENT_INLINE inline
+#    endif
+#else
+#    define FLUENT_INLINE
+#endif
+
 namespace fluent
 {
 
 template <typename T, template <typename> class crtpType>
 struct crtp
 {
-    constexpr T& underlying()
+    FLUENT_INLINE constexpr T& underlying() noexcept
     {
         return static_cast<T&>(*this);
     }
-    constexpr T const& underlying() const
+    FLUENT_INLINE constexpr T const& underlying() const noexcept
     {
         return static_cast<T const&>(*this);
     }
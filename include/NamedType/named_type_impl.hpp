@@ -1,6 +1,10 @@
 #ifndef named_type_impl_h
 #define named_type_impl_h
 
+#include "crtp.hpp"
+
+#include <cstddef>
+#include <initializer_list>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -12,6 +16,13 @@
 #    define FLUENT_EBCO
 #endif
 
+// std::in_place_t comes with C++17
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#    define FLUENT_HAS_IN_PLACE 1
+#else
+#    define FLUENT_HAS_IN_PLACE 0
+#endif
+
 #if defined(__clang__) || defined(__GNUC__)
 #   define IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN                                                                \
     _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Weffc++\"")
@@ -27,62 +38,110 @@ namespace fluent
 template <typename T>
 using IsNotReference = typename std::enable_if<!std::is_reference<T>::value, void>::type;
 
+// Lets a class derive from NamedType to be a strong type of its own, when passed as its parameter:
+//   struct Meter : NamedType<double, derived<Meter>, Addable, Comparable>
+//   {
+//       using NamedType::NamedType;
+//   };
+// The skills then operate on Meter, so that a + b is a Meter. And since the skills no longer appear in the type of
+// the strong type, the mangled names of the functions that take it, and its debug information, stay short.
+template <typename Derived>
+struct derived
+{
+};
+
+namespace details
+{
+// The type the skills of a strong type operate on: the derived class if there is one, the NamedType otherwise
+template <typename NamedType_, typename Parameter>
+struct StrongType
+{
+    using type = NamedType_;
+    using parameter = Parameter;
+};
+
+template <typename NamedType_, typename Derived>
+struct StrongType<NamedType_, derived<Derived>>
+{
+    using type = Derived;
+    using parameter = Derived;
+};
+} // namespace details
+
 template <typename T, typename Parameter, template <typename> class... Skills>
-class FLUENT_EBCO NamedType : public Skills<NamedType<T, Parameter, Skills...>>...
+class FLUENT_EBCO NamedType
+    : public Skills<typename details::StrongType<NamedType<T, Parameter, Skills...>, Parameter>::type>...
 {
+    using Strong = typename details::StrongType<NamedType, Parameter>::type;
+
 public:
     using UnderlyingType = T;
 
     // constructor
     template <typename T_ = T, typename = std::enable_if<std::is_default_constructible<T>::value, void>>
-    constexpr NamedType() noexcept(std::is_nothrow_constructible<T>::value) : value_()
+    FLUENT_INLINE constexpr NamedType() noexcept(std::is_nothrow_constructible<T>::value) : value_()
     {
     }
 
-    explicit constexpr NamedType(T const& value) noexcept(std::is_nothrow_copy_constructible<T>::value) : value_(value)
+    FLUENT_INLINE explicit constexpr NamedType(T const& value) noexcept(std::is_nothrow_copy_constructible<T>::value)
+        : value_(value)
     {
     }
 
     template <typename T_ = T, typename = IsNotReference<T_>>
-    explicit constexpr NamedType(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value)
+    FLUENT_INLINE explicit constexpr NamedType(T&& value) noexcept(std::is_nothrow_move_constructible<T>::value)
         : value_(std::move(value))
     {
     }
 
+#if FLUENT_HAS_IN_PLACE
+    // Constructs the underlying value in place from the arguments, without a temporary underlying value
+    template <typename... Args>
+    FLUENT_INLINE explicit constexpr NamedType(std::in_place_t, Args&&... args) noexcept(
+        std::is_nothrow_constructible<T, Args&&...>::value)
+        : value_(std::forward<Args>(args)...)
+    {
+    }
+#endif
+
     // get
-    constexpr T& get() noexcept
+    FLUENT_INLINE constexpr T& get() noexcept
     {
         return value_;
     }
 
-    constexpr std::remove_reference_t<T> const& get() const noexcept
+    FLUENT_INLINE constexpr std::remove_reference_t<T> const& get() const noexcept
     {
         return value_;
     }
 
     // conversions
-    using ref = NamedType<T&, Parameter, Skills...>;
-    operator ref()
+    using ref = NamedType<T&, typename details::StrongType<NamedType, Parameter>::parameter, Skills...>;
+    FLUENT_INLINE operator ref() noexcept
     {
         return ref(value_);
     }
 
     struct argument
     {
-       NamedType operator=(T&& value) const
+       Strong operator=(T&& value) const noexcept(std::is_nothrow_move_constructible<T>::value)
        {
            IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
-           return NamedType(std::forward<T>(value));
+           return Strong(std::forward<T>(value));
 
            IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_END
        }
-        template <typename U>
-        NamedType operator=(U&& value) const
+        // Only implicit conversions to the underlying type, as with the constructors of NamedType
+        template <typename U,
+                  typename = std::enable_if_t<std::is_convertible<U&&, T>::value ||
+                                              std::is_constructible<Strong, U&&>::value>>
+        Strong operator=(U&& value) const
+            noexcept(noexcept(build(std::forward<U>(value), std::is_convertible<U&&, T>{})))
         {
             IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
-            return NamedType(std::forward<U>(value));
+            return build(std::forward<U>(value), std::is_convertible<U&&, T>{});
 
             IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_END
         }
@@ -92,17 +151,37 @@ public:
         argument(argument&&) = delete;
         argument& operator=(argument const&) = delete;
         argument& operator=(argument&&) = delete;
+
+    private:
+        // Builds the underlying value directly from the argument when it can, rather than from a temporary
+        template <typename U>
+        static constexpr Strong build(U&& value, std::true_type /* U implicitly convertible to T */) noexcept(
+            std::is_nothrow_constructible<T, U&&>::value)
+        {
+#if FLUENT_HAS_IN_PLACE
+            return Strong(std::in_place, std::forward<U>(value));
+#else
+            return Strong(T(std::forward<U>(value)));
+#endif
+        }
+
+        template <typename U>
+        static constexpr Strong build(U&& value, std::false_type /* U implicitly convertible to T */) noexcept(
+            std::is_nothrow_constructible<Strong, U&&>::value)
+        {
+            return Strong(std::forward<U>(value));
+        }
     };
-    constexpr const T &operator*() const & {
+    FLUENT_INLINE constexpr const T &operator*() const & noexcept {
       return value_;
     }
-    constexpr T &operator*() & {
+    FLUENT_INLINE constexpr T &operator*() & noexcept {
       return value_;
     }
-    constexpr const T &&operator*() const && {
+    FLUENT_INLINE constexpr const T &&operator*() const && noexcept {
       return std::move(value_);
     }
-    constexpr T &&operator*() && {
+    FLUENT_INLINE constexpr T &&operator*() && noexcept {
       return std::move(value_);
     }
 
@@ -110,27 +189,173 @@ private:
     T value_;
 };
 
+// A type is trivially relocatable when moving it to a new address and ending the life of the original amounts to
+// copying its bytes, as with memcpy. This is the case of trivially copyable types, and can be declared for other
+// types by specializing this trait. A strong type is trivially relocatable when its underlying type is, and its skills
+// are either empty or trivially copyable, so that a skill with state can't be relocated by copying its bytes.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T>
+{
+};
+
+namespace details
+{
+template <typename... SkillTypes>
+constexpr bool areRelocatableSkills()
+{
+    constexpr bool relocatable[] = {
+        (std::is_empty<SkillTypes>::value || std::is_trivially_copyable<SkillTypes>::value)..., true};
+    for (bool skillIsRelocatable : relocatable)
+    {
+        if (!skillIsRelocatable)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace details
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct is_trivially_relocatable<NamedType<T, Parameter, Skills...>>
+    : std::integral_constant<
+          bool,
+          !std::is_reference<T>::value && is_trivially_relocatable<T>::value &&
+              details::areRelocatableSkills<
+                  Skills<typename details::StrongType<NamedType<T, Parameter, Skills...>, Parameter>::type>...>()>
+{
+};
+
 template <template <typename T> class StrongType, typename T>
-constexpr StrongType<T> make_named(T const& value)
+FLUENT_INLINE constexpr StrongType<std::decay_t<T>> make_named(T&& value) noexcept(
+    std::is_nothrow_constructible<std::decay_t<T>, T&&>::value)
 {
-    return StrongType<T>(value);
+    return StrongType<std::decay_t<T>>(std::forward<T>(value));
 }
 
+// A named argument that callers can omit: f then receives the value returned by Default{}().
+// Default is a stateless callable such as std::integral_constant<int, 80>. It can also return a reference to a
+// constant of the strong type, to pass it on with no construction at all:
+//   struct DefaultHost { Host const& operator()() const noexcept { return localhost; } };
+//   auto connect = make_named_arg_function<Host, defaulted<Port, std::integral_constant<int, 80>>>(...);
+//   connect(host = "example.com");
+template <class Strong, class Default>
+struct defaulted
+{
+};
+
 namespace details {
+template <class T>
+struct NamedArgumentTraits
+{
+    using type = T;
+    static constexpr bool has_default = false;
+};
+
+template <class Strong, class Default>
+struct NamedArgumentTraits<defaulted<Strong, Default>>
+{
+    using type = Strong;
+    static constexpr bool has_default = true;
+
+    // the default is passed on as is when it already has the strong type
+    static FLUENT_INLINE constexpr decltype(auto) value(std::true_type /* Default returns a Strong */)
+    {
+        return Default{}();
+    }
+    static FLUENT_INLINE constexpr Strong value(std::false_type /* Default returns a Strong */)
+    {
+        return Strong(Default{}());
+    }
+    static FLUENT_INLINE constexpr decltype(auto) value()
+    {
+        return value(std::is_same<std::decay_t<decltype(Default{}())>, Strong>{});
+    }
+};
+
+// Position of the argument of type T among the arguments of types Us, compared without references nor qualifiers.
+// It is sizeof...(Us) when there is no such argument.
+template <class T, class... Us>
+constexpr std::size_t indexOfArgument()
+{
+    constexpr bool matches[] = {std::is_same<std::decay_t<T>, std::decay_t<Us>>::value..., false};
+    for (std::size_t index = 0; index < sizeof...(Us); ++index)
+    {
+        if (matches[index])
+        {
+            return index;
+        }
+    }
+    return sizeof...(Us);
+}
+
+template <class T, class... Us>
+constexpr std::size_t countOfArgument()
+{
+    constexpr bool matches[] = {std::is_same<std::decay_t<T>, std::decay_t<Us>>::value..., false};
+    std::size_t count = 0;
+    for (std::size_t index = 0; index < sizeof...(Us); ++index)
+    {
+        count += matches[index] ? 1 : 0;
+    }
+    return count;
+}
+
+constexpr bool allOf(std::initializer_list<bool> conditions)
+{
+    for (bool condition : conditions)
+    {
+        if (!condition)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Gets the argument expected as T from the tuple of the arguments passed, of types Us, or its default
+template <class T, class... Us>
+struct NamedArgument
+{
+    using Traits = NamedArgumentTraits<T>;
+    static constexpr std::size_t index = indexOfArgument<typename Traits::type, Us...>();
+    static_assert(index < sizeof...(Us) || Traits::has_default, "Missing named argument");
+
+    template <class Tuple>
+    static FLUENT_INLINE constexpr decltype(auto) get(Tuple& arguments, std::true_type /* passed */)
+    {
+        return std::get<index>(std::move(arguments));
+    }
+    template <class Tuple>
+    static FLUENT_INLINE constexpr decltype(auto) get(Tuple&, std::false_type /* passed */)
+    {
+        return Traits::value();
+    }
+    template <class Tuple>
+    static FLUENT_INLINE constexpr decltype(auto) get(Tuple& arguments)
+    {
+        return get(arguments, std::integral_constant<bool, (index < sizeof...(Us))>{});
+    }
+};
+
 template <class F, class... Ts>
 struct AnyOrderCallable{
    F f;
+   // The arguments are passed on to f as references, in the order of Ts: none of them is copied nor moved on the way
    template <class... Us>
    auto operator()(Us&&...args) const
    {
-       static_assert(sizeof...(Ts) == sizeof...(Us), "Passing wrong number of arguments");
-       auto x = std::make_tuple(std::forward<Us>(args)...);
-       return f(std::move(std::get<Ts>(x))...);
+       static_assert(allOf({(indexOfArgument<Us, typename NamedArgumentTraits<Ts>::type...>() < sizeof...(Ts))...}),
+                     "Passing an unexpected argument");
+       static_assert(allOf({(countOfArgument<Us, Us...>() == 1)...}), "Passing the same argument twice");
+       auto x = std::forward_as_tuple(std::forward<Us>(args)...);
+       return f(NamedArgument<Ts, Us...>::get(x)...);
    }
 };
 } //namespace details
 
 // EXPERIMENTAL - CAN BE CHANGED IN THE FUTURE. FEEDBACK WELCOME FOR IMPROVEMENTS!
+// Args are the strong types of the parameters of f, in order. Wrapping one in defaulted makes it optional.
 template <class... Args, class F>
 auto make_named_arg_function(F&& f)
 {
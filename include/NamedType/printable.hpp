@@ -0,0 +1,33 @@
+#ifndef PRINTABLE_HPP
+#define PRINTABLE_HPP
+
+#include "crtp.hpp"
+#include "named_type_impl.hpp"
+
+// Only the declarations of the streams: the code that prints a strong type includes <ostream> or <iostream> itself,
+// so that the other translation units don't pay for parsing the streams nor for initializing the standard streams.
+#include <iosfwd>
+
+namespace fluent
+{
+
+template <typename T>
+struct Printable : crtp<T, Printable>
+{
+    FLUENT_INLINE void print(std::ostream& os) const noexcept(noexcept(os << this->underlying().get()))
+    {
+        os << this->underlying().get();
+    }
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+FLUENT_INLINE std::ostream& operator<<(std::ostream& os, NamedType<T, Parameter, Skills...> const& object) noexcept(
+    noexcept(object.print(os)))
+{
+    object.print(os);
+    return os;
+}
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,271 @@
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include "named_type_impl.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fluent
+{
+
+namespace details
+{
+// The keys of radix_sort are unsigned integers of the size of the sorted values, in the same order as the values
+template <typename T, typename std::enable_if<std::is_unsigned<T>::value, int>::type = 0>
+FLUENT_INLINE constexpr T radixBits(T value) noexcept
+{
+    return value;
+}
+
+// Flipping the sign bit puts the negative values before the positive ones
+template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+FLUENT_INLINE constexpr typename std::make_unsigned<T>::type radixBits(T value) noexcept
+{
+    using Bits = typename std::make_unsigned<T>::type;
+    return static_cast<Bits>(static_cast<Bits>(value) ^ static_cast<Bits>(Bits{1} << (sizeof(T) * 8 - 1)));
+}
+
+// For IEEE 754 values, flipping the sign bit of the positive values puts them after the negative ones, and flipping
+// all the bits of the negative values orders them from the most negative one
+template <typename Bits, typename T>
+FLUENT_INLINE Bits floatingRadixBits(T value) noexcept
+{
+    static_assert(std::numeric_limits<T>::is_iec559 && sizeof(Bits) == sizeof(T), "radix_sort needs IEEE 754 values");
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    Bits const signBit = static_cast<Bits>(Bits{1} << (sizeof(Bits) * 8 - 1));
+    Bits const mask = (bits & signBit) != 0 ? static_cast<Bits>(~Bits{0}) : signBit;
+    return bits ^ mask;
+}
+
+FLUENT_INLINE std::uint32_t radixBits(float value) noexcept
+{
+    return floatingRadixBits<std::uint32_t>(value);
+}
+
+FLUENT_INLINE std::uint64_t radixBits(double value) noexcept
+{
+    return floatingRadixBits<std::uint64_t>(value);
+}
+
+template <typename Strong>
+FLUENT_INLINE auto radixKey(Strong const& value) noexcept -> decltype(radixBits(value.get()))
+{
+    return radixBits(value.get());
+}
+
+template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+FLUENT_INLINE auto radixKey(T value) noexcept -> decltype(radixBits(value))
+{
+    return radixBits(value);
+}
+
+struct Identity
+{
+    template <typename T>
+    FLUENT_INLINE constexpr T&& operator()(T&& value) const noexcept
+    {
+        return std::forward<T>(value);
+    }
+};
+
+// The number of values under which radix_sort calls std::stable_sort, that doesn't go through all the values for
+// each digit of the keys
+constexpr std::size_t radixSortThreshold = 1024;
+
+// Keys of 32 and 64 bits are sorted by digits of 11 bits, in 3 and 6 passes instead of 4 and 8 with bytes: the 2048
+// counters of a digit still fit in the L1 cache, and on large ranges the passes cost more than the cache misses of
+// writing to 2048 places
+template <typename Bits>
+constexpr std::size_t radixDigitBits()
+{
+    return sizeof(Bits) <= 2 ? 8 : 11;
+}
+
+template <typename Bits>
+using RadixCounts = std::array<std::size_t, std::size_t{1} << radixDigitBits<Bits>()>;
+
+template <typename Bits>
+FLUENT_INLINE constexpr std::size_t radixDigit(Bits key, std::size_t digitIndex) noexcept
+{
+    return static_cast<std::size_t>(key >> (digitIndex * radixDigitBits<Bits>())) &
+           ((std::size_t{1} << radixDigitBits<Bits>()) - 1);
+}
+
+template <typename Destination, typename Value>
+FLUENT_INLINE void radixMove(Destination destination, Value& value, std::false_type /* construct */)
+{
+    *destination = std::move(value);
+}
+
+template <typename Value>
+FLUENT_INLINE void radixMove(Value* destination, Value& value, std::true_type /* construct */)
+{
+    ::new (static_cast<void*>(destination)) Value(std::move(value));
+}
+
+// Moves the values to their position for the digit of the keys at digitIndex, given by offsets, which is the number
+// of values with a lower digit for each digit. Construct moves them to raw storage.
+template <typename Bits, typename Construct, typename Source, typename Destination, typename Projection>
+void radixScatter(Source source, std::size_t size, Destination destination, std::size_t digitIndex,
+                  RadixCounts<Bits>& offsets, Projection& projection)
+{
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        std::size_t const digit = radixDigit(radixKey(projection(source[index])), digitIndex);
+        radixMove(destination + static_cast<std::ptrdiff_t>(offsets[digit]++), source[index], Construct{});
+    }
+}
+
+// The storage where radix_sort moves the values, without constructing them beforehand: the values don't need a
+// default constructor, and the storage is filled by the pass that moves them there
+template <typename Value>
+class RadixBuffer
+{
+public:
+    RadixBuffer() = default;
+    RadixBuffer(RadixBuffer const&) = delete;
+    RadixBuffer& operator=(RadixBuffer const&) = delete;
+
+    ~RadixBuffer()
+    {
+        if (constructed_)
+        {
+            for (std::size_t index = 0; index < size_; ++index)
+            {
+                values_[index].~Value();
+            }
+        }
+        if (values_)
+        {
+            std::allocator<Value>().deallocate(values_, size_);
+        }
+    }
+
+    void allocate(std::size_t size)
+    {
+        values_ = std::allocator<Value>().allocate(size);
+        size_ = size;
+    }
+
+    Value* get() const noexcept
+    {
+        return values_;
+    }
+
+    bool constructed() const noexcept
+    {
+        return constructed_;
+    }
+
+    void setConstructed() noexcept
+    {
+        constructed_ = true;
+    }
+
+private:
+    Value* values_ = nullptr;
+    std::size_t size_ = 0;
+    bool constructed_ = false;
+};
+} // namespace details
+
+// Sorts strong types over integral or floating point types, such as identifiers and timestamps, in linear time, by
+// going over their values once to count the digits of their keys, then once per digit to move them to their position.
+// Projection gives the strong type to sort by, to sort records by one of their members:
+//   radix_sort(timestamps.begin(), timestamps.end());
+//   radix_sort(events.begin(), events.end(), [](Event const& event) { return event.timestamp; });
+// The projection may also return an arithmetic value. Negative values come before positive ones, and -0.0 before
+// 0.0. Like std::stable_sort, it keeps the order of the values with equal keys, and it uses a buffer as large as the
+// range. The digits that are the same for all the keys are skipped, so that small identifiers in 64 bits take fewer
+// than 6 passes.
+template <typename RandomIterator, typename Projection = details::Identity>
+void radix_sort(RandomIterator first, RandomIterator last, Projection projection = Projection())
+{
+    using Value = typename std::iterator_traits<RandomIterator>::value_type;
+    using Bits = decltype(details::radixKey(projection(*first)));
+    constexpr std::size_t digitBits = details::radixDigitBits<Bits>();
+    constexpr std::size_t digits = (sizeof(Bits) * 8 + digitBits - 1) / digitBits;
+
+    auto const size = static_cast<std::size_t>(last - first);
+    if (size < details::radixSortThreshold)
+    {
+        std::stable_sort(first, last, [&projection](Value const& lhs, Value const& rhs) {
+            return details::radixKey(projection(lhs)) < details::radixKey(projection(rhs));
+        });
+        return;
+    }
+
+    // On the heap, as the counters of 64-bit keys take 96 KiB
+    std::vector<details::RadixCounts<Bits>> counts(digits);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        Bits const key = details::radixKey(projection(first[static_cast<std::ptrdiff_t>(index)]));
+        for (std::size_t digitIndex = 0; digitIndex < digits; ++digitIndex)
+        {
+            ++counts[digitIndex][details::radixDigit(key, digitIndex)];
+        }
+    }
+
+    // The values go back and forth between the range and the buffer, one digit after the other
+    Bits const firstKey = details::radixKey(projection(*first));
+    details::RadixBuffer<Value> buffer;
+    bool inBuffer = false;
+    for (std::size_t digitIndex = 0; digitIndex < digits; ++digitIndex)
+    {
+        auto& offsets = counts[digitIndex];
+        if (offsets[details::radixDigit(firstKey, digitIndex)] == size)
+        {
+            continue;
+        }
+        std::size_t offset = 0;
+        for (auto& count : offsets)
+        {
+            offset += count;
+            count = offset - count;
+        }
+        if (!buffer.constructed())
+        {
+            buffer.allocate(size);
+            if (std::is_nothrow_move_constructible<Value>::value)
+            {
+                details::radixScatter<Bits, std::true_type>(first, size, buffer.get(), digitIndex, offsets, projection);
+                buffer.setConstructed();
+                inBuffer = true;
+                continue;
+            }
+            // If a move threw in the middle of a pass, the constructed values would be scattered in the buffer
+            std::uninitialized_copy(std::make_move_iterator(first), std::make_move_iterator(last), buffer.get());
+            buffer.setConstructed();
+            inBuffer = true;
+        }
+        if (inBuffer)
+        {
+            details::radixScatter<Bits, std::false_type>(buffer.get(), size, first, digitIndex, offsets, projection);
+        }
+        else
+        {
+            details::radixScatter<Bits, std::false_type>(first, size, buffer.get(), digitIndex, offsets, projection);
+        }
+        inBuffer = !inBuffer;
+    }
+    if (inBuffer)
+    {
+        std::move(buffer.get(), buffer.get() + size, first);
+    }
+}
+
+} // namespace fluent
+
+#endif
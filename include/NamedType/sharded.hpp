@@ -0,0 +1,102 @@
+#ifndef SHARDED_HPP
+#define SHARDED_HPP
+
+#include "atomic.hpp"
+#include "cache_line.hpp"
+#include "named_type_impl.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <thread>
+
+namespace fluent
+{
+
+namespace details
+{
+// A number that identifies the calling thread, given in the order in which threads first ask for it
+inline std::size_t threadOrdinal() noexcept
+{
+    static std::atomic<std::size_t> nextOrdinal{0};
+    thread_local std::size_t const ordinal = nextOrdinal.fetch_add(1, std::memory_order_relaxed);
+    return ordinal;
+}
+
+// The values above the largest power of two of std::size_t are rounded down to it
+inline std::size_t roundUpToPowerOfTwo(std::size_t value) noexcept
+{
+    constexpr std::size_t largestPowerOfTwo = std::numeric_limits<std::size_t>::max() / 2 + 1;
+    if (value > largestPowerOfTwo)
+    {
+        return largestPowerOfTwo;
+    }
+    std::size_t powerOfTwo = 1;
+    while (powerOfTwo < value)
+    {
+        powerOfTwo *= 2;
+    }
+    return powerOfTwo;
+}
+} // namespace details
+
+// An accumulator of an Addable strong type, for values that many threads add to and that are rarely read, such as
+// metrics. It holds one slot per shard, each on its own cache line, and each thread adds to the slot of its shard.
+// A thread gets its shard the first time it uses any Sharded, in turn, so the first shard_count() threads to do so
+// don't contend with each other on +=; the threads that come after them share the shards. Reading sums the slots.
+//   using Requests = NamedType<std::uint64_t, struct RequestsTag, Addable>;
+//   Sharded<Requests> requests;
+//   requests += Requests{1};      // from any thread
+//   Requests const total = requests.load();
+template <typename Strong>
+class Sharded
+{
+public:
+    // The number of shards is rounded up to a power of two, and is by default the number of hardware threads
+    explicit Sharded(std::size_t shards = std::thread::hardware_concurrency())
+        : mask_(details::roundUpToPowerOfTwo(shards) - 1), slots_(new Slot[mask_ + 1])
+    {
+        static_assert(details::HasOperation<details::AddAssignment, Strong>::value,
+                      "Sharded needs a strong type with the Addable or BinaryAddable skill");
+    }
+
+    Sharded(Sharded const&) = delete;
+    Sharded& operator=(Sharded const&) = delete;
+
+    // Adds to the slot of the calling thread. The addition is relaxed: it doesn't order the other memory accesses.
+    FLUENT_INLINE Sharded& operator+=(Strong const& value) noexcept
+    {
+        slots_[details::threadOrdinal() & mask_].value.fetch_add(value, std::memory_order_relaxed);
+        return *this;
+    }
+
+    // The sum of the slots. The additions that run at the same time may or may not be counted.
+    Strong load() const noexcept(noexcept(std::declval<Strong&>() += std::declval<Strong const&>()))
+    {
+        Strong total = slots_[0].value.load(std::memory_order_relaxed);
+        for (std::size_t shard = 1; shard <= mask_; ++shard)
+        {
+            total += slots_[shard].value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    FLUENT_INLINE std::size_t shard_count() const noexcept
+    {
+        return mask_ + 1;
+    }
+
+private:
+    struct alignas(cache_line_size) Slot
+    {
+        atomic<Strong> value{};
+    };
+
+    std::size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+};
+
+} // namespace fluent
+
+#endif
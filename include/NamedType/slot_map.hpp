@@ -0,0 +1,285 @@
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP
+
+#include "named_type_impl.hpp"
+#include "strong_vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fluent
+{
+
+// A container that designates its elements with handles, strong types over a std::uint64_t of the tag Tag, instead of
+// keys. Its elements are contiguous, in no particular order, and each handle packs the position of a slot that knows
+// where its element is, with the generation of the slot. Inserting, erasing and looking up are O(1) without hashing,
+// and a handle whose element has been erased is detected, even after its slot has been reused:
+//   SlotMap<EntityTag, Entity> entities;
+//   auto const player = entities.insert(Entity{...});
+//   entities.erase(player);
+//   entities.find(player); // nullptr
+// The handles have the skills given after the type of the elements, for instance Comparable or Hashable.
+// Erasing an element moves the last element in its place, so erasing invalidates the iterators and the pointers to
+// the last element, and inserting invalidates all of them, as with std::vector. The handles stay valid until their
+// element is erased. The generations of the slots have 32 bits and wrap around, so a stale handle designates an
+// element again once its slot has been reused 2^31 times.
+template <typename Tag, typename T, template <typename> class... HandleSkills>
+class SlotMap
+{
+public:
+    using handle_type = NamedType<std::uint64_t, Tag, HandleSkills...>;
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    SlotMap() = default;
+
+    template <typename... Args>
+    handle_type emplace(Args&&... args)
+    {
+        reserveFreeSlot();
+        std::uint32_t const slotIndex = firstFreeSlot_;
+        // valueSlots_ stays as long as values_ if constructing the element throws
+        valueSlots_.push_back(slotIndex);
+        try
+        {
+            values_.emplace_back(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            valueSlots_.pop_back();
+            throw;
+        }
+        Slot& slot = slots_[slotIndex];
+        firstFreeSlot_ = slot.position;
+        slot.position = static_cast<std::uint32_t>(values_.size() - 1);
+        ++slot.generation;
+        return makeHandle(slotIndex, slot.generation);
+    }
+
+    handle_type insert(T const& value)
+    {
+        return emplace(value);
+    }
+
+    handle_type insert(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    // Returns false if the element of the handle was already erased
+    bool erase(handle_type handle) noexcept(std::is_nothrow_move_assignable<T>::value)
+    {
+        if (!contains(handle))
+        {
+            return false;
+        }
+        std::uint32_t const slotIndex = slotIndexOf(handle);
+        Slot& slot = slots_[slotIndex];
+        std::uint32_t const position = slot.position;
+        if (position != values_.size() - 1)
+        {
+            values_[position] = std::move(values_.back());
+            valueSlots_[position] = valueSlots_.back();
+            slots_[valueSlots_[position]].position = position;
+        }
+        values_.pop_back();
+        valueSlots_.pop_back();
+
+        ++slot.generation;
+        slot.position = firstFreeSlot_;
+        firstFreeSlot_ = slotIndex;
+        return true;
+    }
+
+    FLUENT_INLINE bool contains(handle_type handle) const noexcept
+    {
+        std::uint32_t const slotIndex = slotIndexOf(handle);
+        return slotIndex < slots_.size() && slots_[slotIndex].generation == generationOf(handle) &&
+               isOccupied(generationOf(handle));
+    }
+
+    // The element of the handle, or nullptr if it was erased
+    FLUENT_INLINE T* find(handle_type handle) noexcept
+    {
+        return contains(handle) ? &values_[slots_[slotIndexOf(handle)].position] : nullptr;
+    }
+
+    FLUENT_INLINE T const* find(handle_type handle) const noexcept
+    {
+        return contains(handle) ? &values_[slots_[slotIndexOf(handle)].position] : nullptr;
+    }
+
+    // The element of a handle that must not have been erased, which is checked as the subscripts of StrongVector are
+    FLUENT_INLINE T& operator[](handle_type handle) noexcept
+    {
+        check(handle);
+        return values_[slots_[slotIndexOf(handle)].position];
+    }
+
+    FLUENT_INLINE T const& operator[](handle_type handle) const noexcept
+    {
+        check(handle);
+        return values_[slots_[slotIndexOf(handle)].position];
+    }
+
+    T& at(handle_type handle)
+    {
+        if (!contains(handle))
+        {
+            throw std::out_of_range("SlotMap::at: the element of the handle was erased");
+        }
+        return values_[slots_[slotIndexOf(handle)].position];
+    }
+
+    T const& at(handle_type handle) const
+    {
+        if (!contains(handle))
+        {
+            throw std::out_of_range("SlotMap::at: the element of the handle was erased");
+        }
+        return values_[slots_[slotIndexOf(handle)].position];
+    }
+
+    // The handle of the element at a position between 0 and size(), to know which element is visited when iterating
+    FLUENT_INLINE handle_type handle_at(size_type position) const noexcept
+    {
+        std::uint32_t const slotIndex = valueSlots_[position];
+        return makeHandle(slotIndex, slots_[slotIndex].generation);
+    }
+
+    FLUENT_INLINE size_type size() const noexcept
+    {
+        return values_.size();
+    }
+
+    FLUENT_INLINE bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+
+    void reserve(size_type capacity)
+    {
+        values_.reserve(capacity);
+        valueSlots_.reserve(capacity);
+        slots_.reserve(capacity);
+    }
+
+    // Erases all the elements. Their handles stay detected as erased.
+    void clear() noexcept
+    {
+        while (!valueSlots_.empty())
+        {
+            std::uint32_t const slotIndex = valueSlots_.back();
+            Slot& slot = slots_[slotIndex];
+            ++slot.generation;
+            slot.position = firstFreeSlot_;
+            firstFreeSlot_ = slotIndex;
+            valueSlots_.pop_back();
+        }
+        values_.clear();
+    }
+
+    FLUENT_INLINE T* data() noexcept
+    {
+        return values_.data();
+    }
+
+    FLUENT_INLINE T const* data() const noexcept
+    {
+        return values_.data();
+    }
+
+    FLUENT_INLINE iterator begin() noexcept
+    {
+        return values_.begin();
+    }
+
+    FLUENT_INLINE const_iterator begin() const noexcept
+    {
+        return values_.begin();
+    }
+
+    FLUENT_INLINE iterator end() noexcept
+    {
+        return values_.end();
+    }
+
+    FLUENT_INLINE const_iterator end() const noexcept
+    {
+        return values_.end();
+    }
+
+private:
+    // The position of the element in values_ when the slot is occupied, and the next free slot when it is free.
+    // The generation is odd when the slot is occupied, and changes each time its element is inserted or erased.
+    struct Slot
+    {
+        std::uint32_t position;
+        std::uint32_t generation;
+    };
+
+    static constexpr std::uint32_t noFreeSlot = std::numeric_limits<std::uint32_t>::max();
+
+    FLUENT_INLINE static constexpr handle_type makeHandle(std::uint32_t slotIndex, std::uint32_t generation) noexcept
+    {
+        return handle_type((std::uint64_t{generation} << 32) | slotIndex);
+    }
+
+    FLUENT_INLINE static constexpr std::uint32_t slotIndexOf(handle_type handle) noexcept
+    {
+        return static_cast<std::uint32_t>(handle.get());
+    }
+
+    FLUENT_INLINE static constexpr std::uint32_t generationOf(handle_type handle) noexcept
+    {
+        return static_cast<std::uint32_t>(handle.get() >> 32);
+    }
+
+    FLUENT_INLINE static constexpr bool isOccupied(std::uint32_t generation) noexcept
+    {
+        return (generation & 1u) != 0;
+    }
+
+    void reserveFreeSlot()
+    {
+        if (firstFreeSlot_ != noFreeSlot)
+        {
+            return;
+        }
+        if (slots_.size() >= noFreeSlot)
+        {
+            throw std::length_error("SlotMap: too many elements");
+        }
+        slots_.push_back(Slot{noFreeSlot, 0});
+        firstFreeSlot_ = static_cast<std::uint32_t>(slots_.size() - 1);
+    }
+
+    FLUENT_INLINE void check(handle_type handle) const noexcept
+    {
+#if FLUENT_CHECKED_INDICES
+        if (!contains(handle))
+        {
+            details::indexOutOfRange();
+        }
+#else
+        (void)handle;
+#endif
+    }
+
+    std::vector<T> values_ = {};
+    // The slot of each element of values_
+    std::vector<std::uint32_t> valueSlots_ = {};
+    std::vector<Slot> slots_ = {};
+    std::uint32_t firstFreeSlot_ = noFreeSlot;
+};
+
+} // namespace fluent
+
+#endif
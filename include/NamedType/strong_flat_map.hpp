@@ -0,0 +1,507 @@
+#ifndef STRONG_FLAT_MAP_HPP
+#define STRONG_FLAT_MAP_HPP
+
+#include "named_type_impl.hpp"
+#include "strong_vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace fluent
+{
+
+// Tells the constructors of StrongFlatSet and StrongFlatMap that their input is already sorted without duplicates
+struct sorted_unique_t
+{
+    explicit sorted_unique_t() = default;
+};
+
+constexpr sorted_unique_t sorted_unique{};
+
+namespace details
+{
+// Orders strong types by their underlying values
+struct UnderlyingLess
+{
+    template <typename Strong>
+    FLUENT_INLINE bool operator()(Strong const& lhs, Strong const& rhs) const noexcept(noexcept(lhs.get() < rhs.get()))
+    {
+        return lhs.get() < rhs.get();
+    }
+};
+
+// The binary search of std::lower_bound, without a branch that depends on the comparisons: the first half of the range
+// is skipped or not with a conditional move, and the processor doesn't mispredict which half to search.
+// The range always halves, so the number of steps only depends on its size.
+template <typename Key, typename Less>
+FLUENT_INLINE Key const* branchlessLowerBound(Key const* first, std::size_t size, Key const& key, Less less)
+{
+    if (size == 0)
+    {
+        return first;
+    }
+    while (size > 1)
+    {
+        std::size_t const half = size / 2;
+        first = less(first[half], key) ? first + half : first;
+        size -= half;
+    }
+    return first + (less(*first, key) ? 1 : 0);
+}
+
+template <typename Key, typename Less>
+FLUENT_INLINE Key const* branchlessUpperBound(Key const* first, std::size_t size, Key const& key, Less less)
+{
+    if (size == 0)
+    {
+        return first;
+    }
+    while (size > 1)
+    {
+        std::size_t const half = size / 2;
+        first = less(key, first[half]) ? first : first + half;
+        size -= half;
+    }
+    return first + (less(key, *first) ? 0 : 1);
+}
+
+template <typename Key>
+FLUENT_INLINE bool equivalent(Key const& lhs, Key const& rhs)
+{
+    return !UnderlyingLess()(lhs, rhs) && !UnderlyingLess()(rhs, lhs);
+}
+
+template <typename Key>
+void sortUnique(std::vector<Key>& keys)
+{
+    std::sort(keys.begin(), keys.end(), UnderlyingLess());
+    keys.erase(std::unique(keys.begin(), keys.end(), equivalent<Key>), keys.end());
+}
+} // namespace details
+
+// A set of strong types in a sorted std::vector, for the sets that are mostly read: looking up is a binary search over
+// contiguous keys, without the allocation per element and the pointer chasing of std::set.
+//   using UserId = NamedType<std::uint64_t, struct UserIdTag, Comparable>;
+//   StrongFlatSet<UserId> const banned(loadBannedIds()); // sorted and deduplicated once
+//   if (banned.contains(userId)) {...}
+// The keys are ordered by their underlying values. Inserting a single key moves the ones after it, so adding many keys
+// is best done with the batched insert, which sorts them and merges them in at once.
+template <typename Key>
+class StrongFlatSet
+{
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = std::size_t;
+    using const_iterator = typename std::vector<Key>::const_iterator;
+    using iterator = const_iterator;
+
+    StrongFlatSet() = default;
+
+    // Sorts the keys and removes their duplicates
+    explicit StrongFlatSet(std::vector<Key> keys) : keys_(std::move(keys))
+    {
+        details::sortUnique(keys_);
+    }
+
+    StrongFlatSet(sorted_unique_t, std::vector<Key> keys) noexcept : keys_(std::move(keys))
+    {
+    }
+
+    template <typename InputIterator>
+    StrongFlatSet(InputIterator first, InputIterator last) : StrongFlatSet(std::vector<Key>(first, last))
+    {
+    }
+
+    StrongFlatSet(std::initializer_list<Key> keys) : StrongFlatSet(std::vector<Key>(keys))
+    {
+    }
+
+    FLUENT_INLINE const_iterator lower_bound(Key const& key) const
+    {
+        return begin() + (details::branchlessLowerBound(keys_.data(), keys_.size(), key, details::UnderlyingLess()) -
+                          keys_.data());
+    }
+
+    FLUENT_INLINE const_iterator upper_bound(Key const& key) const
+    {
+        return begin() + (details::branchlessUpperBound(keys_.data(), keys_.size(), key, details::UnderlyingLess()) -
+                          keys_.data());
+    }
+
+    FLUENT_INLINE const_iterator find(Key const& key) const
+    {
+        const_iterator const found = lower_bound(key);
+        return found != end() && !details::UnderlyingLess()(key, *found) ? found : end();
+    }
+
+    FLUENT_INLINE bool contains(Key const& key) const
+    {
+        return find(key) != end();
+    }
+
+    FLUENT_INLINE size_type count(Key const& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    // Returns the position of the key, and whether it was inserted
+    std::pair<const_iterator, bool> insert(Key const& key)
+    {
+        const_iterator const found = lower_bound(key);
+        if (found != end() && !details::UnderlyingLess()(key, *found))
+        {
+            return std::make_pair(found, false);
+        }
+        return std::make_pair(keys_.insert(found, key), true);
+    }
+
+    // Inserts a batch of keys, in any order: sorts them, and merges them with the keys of the set in linear time
+    template <typename InputIterator>
+    void insert(InputIterator first, InputIterator last)
+    {
+        // Copied first, as the batch may come from the keys of the set
+        std::vector<Key> batch(first, last);
+        std::sort(batch.begin(), batch.end(), details::UnderlyingLess());
+        auto const size = keys_.size();
+        keys_.insert(keys_.end(), std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+        auto const middle = keys_.begin() + static_cast<std::ptrdiff_t>(size);
+        std::inplace_merge(keys_.begin(), middle, keys_.end(), details::UnderlyingLess());
+        keys_.erase(std::unique(keys_.begin(), keys_.end(), details::equivalent<Key>), keys_.end());
+    }
+
+    void insert(std::initializer_list<Key> keys)
+    {
+        insert(keys.begin(), keys.end());
+    }
+
+    // Inserts the keys of another set, which are already sorted
+    void merge(StrongFlatSet const& other)
+    {
+        if (&other == this)
+        {
+            return;
+        }
+        auto const size = keys_.size();
+        keys_.insert(keys_.end(), other.keys_.begin(), other.keys_.end());
+        auto const middle = keys_.begin() + static_cast<std::ptrdiff_t>(size);
+        std::inplace_merge(keys_.begin(), middle, keys_.end(), details::UnderlyingLess());
+        keys_.erase(std::unique(keys_.begin(), keys_.end(), details::equivalent<Key>), keys_.end());
+    }
+
+    // Returns the number of erased keys, 0 or 1
+    size_type erase(Key const& key)
+    {
+        const_iterator const found = find(key);
+        if (found == end())
+        {
+            return 0;
+        }
+        keys_.erase(found);
+        return 1;
+    }
+
+    FLUENT_INLINE size_type size() const noexcept
+    {
+        return keys_.size();
+    }
+
+    FLUENT_INLINE bool empty() const noexcept
+    {
+        return keys_.empty();
+    }
+
+    void reserve(size_type capacity)
+    {
+        keys_.reserve(capacity);
+    }
+
+    void clear() noexcept
+    {
+        keys_.clear();
+    }
+
+    FLUENT_INLINE const_iterator begin() const noexcept
+    {
+        return keys_.begin();
+    }
+
+    FLUENT_INLINE const_iterator end() const noexcept
+    {
+        return keys_.end();
+    }
+
+    FLUENT_INLINE Key const* data() const noexcept
+    {
+        return keys_.data();
+    }
+
+    // The sorted keys, to hand them to the code that doesn't know about the set
+    FLUENT_INLINE std::vector<Key> const& get() const noexcept
+    {
+        return keys_;
+    }
+
+    friend bool operator==(StrongFlatSet const& lhs, StrongFlatSet const& rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), details::equivalent<Key>);
+    }
+
+    friend bool operator!=(StrongFlatSet const& lhs, StrongFlatSet const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    std::vector<Key> keys_ = {};
+};
+
+// A map from strong types to values, with the keys in a sorted std::vector and the values at the same positions in
+// another one, so that the binary search only reads keys:
+//   using UserId = NamedType<std::uint64_t, struct UserIdTag, Comparable>;
+//   StrongFlatMap<UserId, Permissions> const permissions(loadPermissions()); // sorted once
+//   if (Permissions const* userPermissions = permissions.find(userId)) {...}
+// Its interface follows the one of StrongHashMap: find returns a pointer to the value, and for_each visits the
+// elements, here in the order of their keys. lower_bound and upper_bound return positions in keys() and values().
+// As with StrongFlatSet, adding many elements is best done with the batched insert.
+template <typename Key, typename Value>
+class StrongFlatMap
+{
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using size_type = std::size_t;
+
+    StrongFlatMap() = default;
+
+    // Sorts the elements by key. Of the elements with the same key, the first one is kept.
+    explicit StrongFlatMap(std::vector<std::pair<Key, Value>> elements)
+    {
+        insert(std::make_move_iterator(elements.begin()), std::make_move_iterator(elements.end()));
+    }
+
+    // keys and values must have the same size, which is checked as the subscripts of StrongVector are
+    StrongFlatMap(sorted_unique_t, std::vector<Key> keys, std::vector<Value> values) noexcept
+        : keys_(std::move(keys)), values_(std::move(values))
+    {
+#if FLUENT_CHECKED_INDICES
+        if (keys_.size() != values_.size())
+        {
+            details::indexOutOfRange();
+        }
+#endif
+    }
+
+    StrongFlatMap(std::initializer_list<std::pair<Key, Value>> elements)
+        : StrongFlatMap(std::vector<std::pair<Key, Value>>(elements))
+    {
+    }
+
+    FLUENT_INLINE size_type lower_bound(Key const& key) const
+    {
+        return static_cast<size_type>(
+            details::branchlessLowerBound(keys_.data(), keys_.size(), key, details::UnderlyingLess()) - keys_.data());
+    }
+
+    FLUENT_INLINE size_type upper_bound(Key const& key) const
+    {
+        return static_cast<size_type>(
+            details::branchlessUpperBound(keys_.data(), keys_.size(), key, details::UnderlyingLess()) - keys_.data());
+    }
+
+    // The value of the key, or nullptr if the key isn't in the map
+    FLUENT_INLINE Value* find(Key const& key)
+    {
+        size_type const position = findPosition(key);
+        return position == keys_.size() ? nullptr : &values_[position];
+    }
+
+    FLUENT_INLINE Value const* find(Key const& key) const
+    {
+        size_type const position = findPosition(key);
+        return position == keys_.size() ? nullptr : &values_[position];
+    }
+
+    FLUENT_INLINE bool contains(Key const& key) const
+    {
+        return findPosition(key) != keys_.size();
+    }
+
+    // Constructs the value from args if the key isn't in the map yet. Returns the value of the key, and whether it
+    // was inserted.
+    template <typename... Args>
+    std::pair<Value*, bool> try_emplace(Key const& key, Args&&... args)
+    {
+        size_type const position = lower_bound(key);
+        if (position != keys_.size() && !details::UnderlyingLess()(key, keys_[position]))
+        {
+            return std::make_pair(&values_[position], false);
+        }
+        auto const offset = static_cast<std::ptrdiff_t>(position);
+        // keys_ stays as long as values_ if constructing the value throws
+        keys_.insert(keys_.begin() + offset, key);
+        try
+        {
+            values_.emplace(values_.begin() + offset, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            keys_.erase(keys_.begin() + offset);
+            throw;
+        }
+        return std::make_pair(&values_[position], true);
+    }
+
+    template <typename V>
+    std::pair<Value*, bool> insert_or_assign(Key const& key, V&& value)
+    {
+        auto const inserted = try_emplace(key, std::forward<V>(value));
+        if (!inserted.second)
+        {
+            *inserted.first = std::forward<V>(value);
+        }
+        return inserted;
+    }
+
+    Value& operator[](Key const& key)
+    {
+        return *try_emplace(key).first;
+    }
+
+    // Inserts a batch of elements, pairs of a key and a value in any order: sorts them, and merges them with the
+    // elements of the map in linear time. The elements whose key is already in the map, or earlier in the batch, are
+    // not inserted. The elements of the map are moved to the merged vectors only if that can't throw, and copied
+    // otherwise, so that the map is unchanged if inserting throws.
+    template <typename InputIterator>
+    void insert(InputIterator first, InputIterator last)
+    {
+        using Element = std::pair<Key, Value>;
+        std::vector<Element> batch(first, last);
+        std::stable_sort(batch.begin(), batch.end(), [](Element const& lhs, Element const& rhs) {
+            return details::UnderlyingLess()(lhs.first, rhs.first);
+        });
+
+        std::vector<Key> keys;
+        std::vector<Value> values;
+        keys.reserve(keys_.size() + batch.size());
+        values.reserve(keys_.size() + batch.size());
+        size_type position = 0;
+        for (auto& element : batch)
+        {
+            while (position < keys_.size() && details::UnderlyingLess()(keys_[position], element.first))
+            {
+                keys.push_back(std::move_if_noexcept(keys_[position]));
+                values.push_back(std::move_if_noexcept(values_[position]));
+                ++position;
+            }
+            bool const inMap = position < keys_.size() && !details::UnderlyingLess()(element.first, keys_[position]);
+            bool const inBatch = !keys.empty() && !details::UnderlyingLess()(keys.back(), element.first);
+            if (!inMap && !inBatch)
+            {
+                keys.push_back(std::move(element.first));
+                values.push_back(std::move(element.second));
+            }
+        }
+        for (; position < keys_.size(); ++position)
+        {
+            keys.push_back(std::move_if_noexcept(keys_[position]));
+            values.push_back(std::move_if_noexcept(values_[position]));
+        }
+        keys_ = std::move(keys);
+        values_ = std::move(values);
+    }
+
+    void insert(std::initializer_list<std::pair<Key, Value>> elements)
+    {
+        insert(elements.begin(), elements.end());
+    }
+
+    // Returns the number of erased elements, 0 or 1
+    size_type erase(Key const& key)
+    {
+        size_type const position = findPosition(key);
+        if (position == keys_.size())
+        {
+            return 0;
+        }
+        keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(position));
+        values_.erase(values_.begin() + static_cast<std::ptrdiff_t>(position));
+        return 1;
+    }
+
+    // Calls f with the key and the value of each element, in the order of the keys
+    template <typename Function>
+    void for_each(Function&& f)
+    {
+        for (size_type position = 0; position < keys_.size(); ++position)
+        {
+            f(static_cast<Key const&>(keys_[position]), values_[position]);
+        }
+    }
+
+    template <typename Function>
+    void for_each(Function&& f) const
+    {
+        for (size_type position = 0; position < keys_.size(); ++position)
+        {
+            f(keys_[position], values_[position]);
+        }
+    }
+
+    FLUENT_INLINE size_type size() const noexcept
+    {
+        return keys_.size();
+    }
+
+    FLUENT_INLINE bool empty() const noexcept
+    {
+        return keys_.empty();
+    }
+
+    void reserve(size_type capacity)
+    {
+        keys_.reserve(capacity);
+        values_.reserve(capacity);
+    }
+
+    void clear() noexcept
+    {
+        keys_.clear();
+        values_.clear();
+    }
+
+    // The sorted keys, and the values at the same positions
+    FLUENT_INLINE std::vector<Key> const& keys() const noexcept
+    {
+        return keys_;
+    }
+
+    FLUENT_INLINE std::vector<Value> const& values() const noexcept
+    {
+        return values_;
+    }
+
+    FLUENT_INLINE std::vector<Value>& values() noexcept
+    {
+        return values_;
+    }
+
+private:
+    // The position of the key, or size() if it isn't in the map
+    FLUENT_INLINE size_type findPosition(Key const& key) const
+    {
+        size_type const position = lower_bound(key);
+        return position != keys_.size() && !details::UnderlyingLess()(key, keys_[position]) ? position : keys_.size();
+    }
+
+    std::vector<Key> keys_ = {};
+    std::vector<Value> values_ = {};
+};
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,825 @@
+#ifndef STRONG_HASH_MAP_HPP
+#define STRONG_HASH_MAP_HPP
+
+#include "named_type_impl.hpp"
+#include "underlying_functionalities.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Define FLUENT_HAS_SSE2 to 0 to compare the control bytes of StrongHashMap without SSE2 even when it is available
+#if !defined(FLUENT_HAS_SSE2)
+#    if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define FLUENT_HAS_SSE2 1
+#    else
+#        define FLUENT_HAS_SSE2 0
+#    endif
+#endif
+
+#if FLUENT_HAS_SSE2
+#    include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#endif
+
+namespace fluent
+{
+
+namespace details
+{
+// The tag of a strong type: its Parameter, or the strong type itself when it is a class derived from NamedType
+template <typename Strong>
+struct TagOf
+{
+    using type = Strong;
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct TagOf<NamedType<T, Parameter, Skills...>>
+{
+    using type = typename StrongType<NamedType<T, Parameter, Skills...>, Parameter>::parameter;
+};
+
+// Whether the tag of the strong type reserves an underlying value that no strong type of the tag holds, with
+//   struct UserIdTag { static constexpr std::uint64_t invalid_value = 0; };
+template <typename Strong, typename = void>
+struct HasInvalidValue : std::false_type
+{
+};
+
+template <typename Strong>
+struct HasInvalidValue<Strong, typename make_void<decltype(TagOf<Strong>::type::invalid_value)>::type> : std::true_type
+{
+};
+
+// The hash of a key, mixed with AvalancheHashMixer unless the strong type already mixes its hash: the tables below
+// take their positions from the low bits of the hash, which std::hash leaves clustered for integers
+template <typename Key>
+FLUENT_INLINE std::size_t hashKey(Key const& key) noexcept
+{
+    return HasHashMixer<Key>::value ? std::hash<Key>()(key) : AvalancheHashMixer::mix(std::hash<Key>()(key));
+}
+
+template <typename Key>
+FLUENT_INLINE bool equalKeys(Key const& lhs, Key const& rhs) noexcept(noexcept(lhs.get() == rhs.get()))
+{
+    return lhs.get() == rhs.get();
+}
+
+inline std::uint32_t countTrailingZeros(std::uint64_t bits) noexcept
+{
+#if defined(__clang__) || defined(__GNUC__)
+    return static_cast<std::uint32_t>(__builtin_ctzll(bits));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return static_cast<std::uint32_t>(index);
+#else
+    std::uint32_t count = 0;
+    while ((bits & 1u) == 0)
+    {
+        bits >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+inline std::size_t hashMapCapacity(std::size_t minimum) noexcept
+{
+    std::size_t capacity = 16;
+    while (capacity < minimum)
+    {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+// Storage for an object that the tables construct and destroy themselves
+template <typename T>
+union Uninitialized
+{
+    FLUENT_INLINE Uninitialized() noexcept : none()
+    {
+    }
+
+    FLUENT_INLINE ~Uninitialized()
+    {
+    }
+
+    char none;
+    T value;
+};
+
+// The control bytes of ControlByteHashMap, one per slot: the 7 low bits of the hash of the key when the slot is full
+using ControlByte = std::int8_t;
+constexpr ControlByte emptyControl = -128;
+constexpr ControlByte deletedControl = -2;
+
+// The control bytes of consecutive slots, compared together. The matches are bit masks with one bit per slot, or
+// with 8 bits per slot for the portable version, of which the slots are given by matchedSlot.
+#if FLUENT_HAS_SSE2
+class ControlGroup
+{
+public:
+    static constexpr std::size_t width = 16;
+
+    FLUENT_INLINE explicit ControlGroup(ControlByte const* control) noexcept
+        : control_(_mm_loadu_si128(reinterpret_cast<__m128i const*>(control)))
+    {
+    }
+
+    FLUENT_INLINE std::uint64_t match(ControlByte hash) const noexcept
+    {
+        return static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash), control_)));
+    }
+
+    FLUENT_INLINE std::uint64_t matchEmpty() const noexcept
+    {
+        return match(emptyControl);
+    }
+
+    // The empty and deleted bytes are the negative ones
+    FLUENT_INLINE std::uint64_t matchEmptyOrDeleted() const noexcept
+    {
+        return static_cast<std::uint16_t>(_mm_movemask_epi8(control_));
+    }
+
+    FLUENT_INLINE static std::size_t matchedSlot(std::uint64_t match) noexcept
+    {
+        return countTrailingZeros(match);
+    }
+
+private:
+    __m128i control_;
+};
+#else
+// The same operations on 8 control bytes at a time in a std::uint64_t, where a match sets the high bit of the byte
+class ControlGroup
+{
+public:
+    static constexpr std::size_t width = 8;
+
+    FLUENT_INLINE explicit ControlGroup(ControlByte const* control) noexcept : control_(0)
+    {
+        unsigned char bytes[width];
+        std::memcpy(bytes, control, width);
+        for (std::size_t byte = 0; byte < width; ++byte)
+        {
+            control_ |= std::uint64_t{bytes[byte]} << (8 * byte);
+        }
+    }
+
+    // May also match a byte that follows a match, which doesn't matter since the keys of the matches are compared
+    FLUENT_INLINE std::uint64_t match(ControlByte hash) const noexcept
+    {
+        std::uint64_t const difference = control_ ^ (lsbs * static_cast<unsigned char>(hash));
+        return (difference - lsbs) & ~difference & msbs;
+    }
+
+    FLUENT_INLINE std::uint64_t matchEmpty() const noexcept
+    {
+        return control_ & ~(control_ << 6) & msbs;
+    }
+
+    FLUENT_INLINE std::uint64_t matchEmptyOrDeleted() const noexcept
+    {
+        return control_ & msbs;
+    }
+
+    FLUENT_INLINE static std::size_t matchedSlot(std::uint64_t match) noexcept
+    {
+        return countTrailingZeros(match) / 8;
+    }
+
+private:
+    static constexpr std::uint64_t lsbs = 0x0101010101010101ULL;
+    static constexpr std::uint64_t msbs = 0x8080808080808080ULL;
+
+    std::uint64_t control_;
+};
+#endif
+
+// The open addressing table of StrongHashMap for the keys whose tag doesn't reserve an invalid value, in the manner
+// of Swiss tables: a control byte per slot tells whether it is empty, deleted, or full, with 7 bits of the hash of its
+// key. Looking up compares the control bytes of a group of consecutive slots at once, and only compares the keys of
+// the slots whose 7 bits match. The groups are probed quadratically, and the table is at most 7/8 full.
+template <typename Key, typename Value>
+class ControlByteHashMap
+{
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using size_type = std::size_t;
+
+    ControlByteHashMap() noexcept = default;
+
+    explicit ControlByteHashMap(size_type capacity) : ControlByteHashMap()
+    {
+        reserve(capacity);
+    }
+
+    ControlByteHashMap(ControlByteHashMap const& other) : ControlByteHashMap(other.size())
+    {
+        other.for_each([this](Key const& key, Value const& value) { try_emplace(key, value); });
+    }
+
+    ControlByteHashMap(ControlByteHashMap&& other) noexcept
+        : control_(std::move(other.control_)), slots_(std::move(other.slots_)), capacity_(other.capacity_),
+          size_(other.size_), growthLeft_(other.growthLeft_)
+    {
+        other.capacity_ = 0;
+        other.size_ = 0;
+        other.growthLeft_ = 0;
+    }
+
+    ControlByteHashMap& operator=(ControlByteHashMap other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~ControlByteHashMap()
+    {
+        destroyAll();
+    }
+
+    void swap(ControlByteHashMap& other) noexcept
+    {
+        std::swap(control_, other.control_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(growthLeft_, other.growthLeft_);
+    }
+
+    FLUENT_INLINE Value* find(Key const& key) noexcept
+    {
+        size_type const slot = findSlot(key, hashKey(key));
+        return slot == npos ? nullptr : &slots_[slot].value.value;
+    }
+
+    FLUENT_INLINE Value const* find(Key const& key) const noexcept
+    {
+        size_type const slot = findSlot(key, hashKey(key));
+        return slot == npos ? nullptr : &slots_[slot].value.value;
+    }
+
+    FLUENT_INLINE bool contains(Key const& key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    // Constructs the value from args if the key isn't in the map yet. Returns the value of the key, and whether it
+    // was inserted.
+    template <typename... Args>
+    std::pair<Value*, bool> try_emplace(Key const& key, Args&&... args)
+    {
+        std::size_t const hash = hashKey(key);
+        size_type const found = findSlot(key, hash);
+        if (found != npos)
+        {
+            return std::make_pair(&slots_[found].value.value, false);
+        }
+        if (growthLeft_ == 0)
+        {
+            rehash(size_ + 1 > capacity_ / 2 ? capacity_ * 2 : capacity_);
+        }
+        size_type const slot = findFirstNonFull(hash);
+        ::new (static_cast<void*>(&slots_[slot].value)) Entry{key, Value(std::forward<Args>(args)...)};
+        if (control_[slot] == emptyControl)
+        {
+            --growthLeft_;
+        }
+        setControl(slot, lowHash(hash));
+        ++size_;
+        return std::make_pair(&slots_[slot].value.value, true);
+    }
+
+    template <typename V>
+    std::pair<Value*, bool> insert_or_assign(Key const& key, V&& value)
+    {
+        auto const inserted = try_emplace(key, std::forward<V>(value));
+        if (!inserted.second)
+        {
+            *inserted.first = std::forward<V>(value);
+        }
+        return inserted;
+    }
+
+    Value& operator[](Key const& key)
+    {
+        return *try_emplace(key).first;
+    }
+
+    // Returns false if the key wasn't in the map
+    bool erase(Key const& key) noexcept
+    {
+        size_type const slot = findSlot(key, hashKey(key));
+        if (slot == npos)
+        {
+            return false;
+        }
+        slots_[slot].value.~Entry();
+        setControl(slot, deletedControl);
+        --size_;
+        return true;
+    }
+
+    // Calls f with the key and the value of each element, in no particular order
+    template <typename Function>
+    void for_each(Function&& f)
+    {
+        for (size_type slot = 0; slot < capacity_; ++slot)
+        {
+            if (control_[slot] >= 0)
+            {
+                f(static_cast<Key const&>(slots_[slot].value.key), slots_[slot].value.value);
+            }
+        }
+    }
+
+    template <typename Function>
+    void for_each(Function&& f) const
+    {
+        for (size_type slot = 0; slot < capacity_; ++slot)
+        {
+            if (control_[slot] >= 0)
+            {
+                f(static_cast<Key const&>(slots_[slot].value.key), static_cast<Value const&>(slots_[slot].value.value));
+            }
+        }
+    }
+
+    FLUENT_INLINE size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    FLUENT_INLINE bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    // The number of slots, of which at most 7/8 are full
+    FLUENT_INLINE size_type capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    // Makes room for count elements without rehashing
+    void reserve(size_type count)
+    {
+        if (count > maxSize(capacity_))
+        {
+            rehash(hashMapCapacity(count + count / 7 + 1));
+        }
+    }
+
+    void clear() noexcept
+    {
+        destroyAll();
+        if (capacity_ != 0)
+        {
+            std::memset(control_.get(), static_cast<unsigned char>(emptyControl), capacity_ + ControlGroup::width);
+        }
+        size_ = 0;
+        growthLeft_ = maxSize(capacity_);
+    }
+
+private:
+    struct Entry
+    {
+        Key key;
+        Value value;
+    };
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    FLUENT_INLINE static size_type maxSize(size_type capacity) noexcept
+    {
+        return capacity - capacity / 8;
+    }
+
+    FLUENT_INLINE static ControlByte lowHash(std::size_t hash) noexcept
+    {
+        return static_cast<ControlByte>(hash & 0x7f);
+    }
+
+    FLUENT_INLINE size_type findSlot(Key const& key, std::size_t hash) const noexcept
+    {
+        if (capacity_ == 0)
+        {
+            return npos;
+        }
+        size_type const mask = capacity_ - 1;
+        ControlByte const low = lowHash(hash);
+        size_type position = (hash >> 7) & mask;
+        for (size_type step = ControlGroup::width;; step += ControlGroup::width)
+        {
+            ControlGroup const group(control_.get() + position);
+            for (std::uint64_t match = group.match(low); match != 0; match &= match - 1)
+            {
+                size_type const slot = (position + ControlGroup::matchedSlot(match)) & mask;
+                if (equalKeys(slots_[slot].value.key, key))
+                {
+                    return slot;
+                }
+            }
+            if (group.matchEmpty() != 0)
+            {
+                return npos;
+            }
+            position = (position + step) & mask;
+        }
+    }
+
+    size_type findFirstNonFull(std::size_t hash) const noexcept
+    {
+        size_type const mask = capacity_ - 1;
+        size_type position = (hash >> 7) & mask;
+        for (size_type step = ControlGroup::width;; step += ControlGroup::width)
+        {
+            std::uint64_t const match = ControlGroup(control_.get() + position).matchEmptyOrDeleted();
+            if (match != 0)
+            {
+                return (position + ControlGroup::matchedSlot(match)) & mask;
+            }
+            position = (position + step) & mask;
+        }
+    }
+
+    // The bytes after the last control byte repeat the first ones, for the groups that start near the end
+    FLUENT_INLINE void setControl(size_type slot, ControlByte control) noexcept
+    {
+        control_[slot] = control;
+        if (slot < ControlGroup::width)
+        {
+            control_[capacity_ + slot] = control;
+        }
+    }
+
+    void rehash(size_type capacity)
+    {
+        capacity = hashMapCapacity(capacity);
+        ControlByteHashMap rehashed;
+        rehashed.control_.reset(new ControlByte[capacity + ControlGroup::width]);
+        std::memset(rehashed.control_.get(), static_cast<unsigned char>(emptyControl), capacity + ControlGroup::width);
+        rehashed.slots_.reset(new Slot[capacity]);
+        rehashed.capacity_ = capacity;
+        rehashed.growthLeft_ = maxSize(capacity);
+        for (size_type slot = 0; slot < capacity_; ++slot)
+        {
+            if (control_[slot] >= 0)
+            {
+                Entry& entry = slots_[slot].value;
+                std::size_t const hash = hashKey(entry.key);
+                size_type const newSlot = rehashed.findFirstNonFull(hash);
+                ::new (static_cast<void*>(&rehashed.slots_[newSlot].value)) Entry{std::move(entry)};
+                rehashed.setControl(newSlot, lowHash(hash));
+                --rehashed.growthLeft_;
+                ++rehashed.size_;
+            }
+        }
+        swap(rehashed);
+    }
+
+    void destroyAll() noexcept
+    {
+        for (size_type slot = 0; slot < capacity_; ++slot)
+        {
+            if (control_[slot] >= 0)
+            {
+                slots_[slot].value.~Entry();
+                control_[slot] = emptyControl;
+            }
+        }
+    }
+
+    using Slot = Uninitialized<Entry>;
+
+    std::unique_ptr<ControlByte[]> control_ = nullptr;
+    std::unique_ptr<Slot[]> slots_ = nullptr;
+    size_type capacity_ = 0;
+    size_type size_ = 0;
+    size_type growthLeft_ = 0;
+};
+
+// The open addressing table of StrongHashMap for the keys whose tag reserves an invalid value: a slot is empty when
+// its key is the invalid value, so the table has no memory besides its slots, and looking up only reads the slots.
+// The slots are probed linearly, erasing shifts back the elements that follow instead of leaving tombstones, and the
+// table is at most 3/4 full. Shifting moves the values, which must not throw: a value moved halfway would leave a slot
+// with a key and no value.
+template <typename Key, typename Value>
+class InvalidKeyHashMap
+{
+    static_assert(std::is_nothrow_move_constructible<Value>::value,
+                  "the values of InvalidKeyHashMap must be nothrow move constructible");
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using size_type = std::size_t;
+
+    InvalidKeyHashMap() noexcept = default;
+
+    explicit InvalidKeyHashMap(size_type capacity) : InvalidKeyHashMap()
+    {
+        reserve(capacity);
+    }
+
+    InvalidKeyHashMap(InvalidKeyHashMap const& other) : InvalidKeyHashMap(other.size())
+    {
+        other.for_each([this](Key const& key, Value const& value) { try_emplace(key, value); });
+    }
+
+    InvalidKeyHashMap(InvalidKeyHashMap&& other) noexcept
+        : slots_(std::move(other.slots_)), capacity_(other.capacity_), size_(other.size_)
+    {
+        other.capacity_ = 0;
+        other.size_ = 0;
+    }
+
+    InvalidKeyHashMap& operator=(InvalidKeyHashMap other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~InvalidKeyHashMap()
+    {
+        destroyAll();
+    }
+
+    void swap(InvalidKeyHashMap& other) noexcept
+    {
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+    }
+
+    FLUENT_INLINE Value* find(Key const& key) noexcept
+    {
+        size_type const slot = findSlot(key);
+        return slot == npos ? nullptr : &slots_[slot].value.value;
+    }
+
+    FLUENT_INLINE Value const* find(Key const& key) const noexcept
+    {
+        size_type const slot = findSlot(key);
+        return slot == npos ? nullptr : &slots_[slot].value.value;
+    }
+
+    FLUENT_INLINE bool contains(Key const& key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    // Constructs the value from args if the key isn't in the map yet. Returns the value of the key, and whether it
+    // was inserted. Throws std::invalid_argument if the key is the invalid value of its tag.
+    template <typename... Args>
+    std::pair<Value*, bool> try_emplace(Key const& key, Args&&... args)
+    {
+        if (isEmpty(key))
+        {
+            throw std::invalid_argument("StrongHashMap: the key is the invalid value of its tag");
+        }
+        // Looks up the key first, so that finding a key already in the map never grows it
+        size_type const found = findSlot(key);
+        if (found != npos)
+        {
+            return std::make_pair(&slots_[found].value.value, false);
+        }
+        if (size_ + 1 > maxSize(capacity_))
+        {
+            rehash(capacity_ * 2);
+        }
+        size_type const mask = capacity_ - 1;
+        for (size_type slot = hashKey(key) & mask;; slot = (slot + 1) & mask)
+        {
+            if (isEmpty(slots_[slot].key))
+            {
+                ::new (static_cast<void*>(&slots_[slot].value.value)) Value(std::forward<Args>(args)...);
+                slots_[slot].key = key;
+                ++size_;
+                return std::make_pair(&slots_[slot].value.value, true);
+            }
+        }
+    }
+
+    template <typename V>
+    std::pair<Value*, bool> insert_or_assign(Key const& key, V&& value)
+    {
+        auto const inserted = try_emplace(key, std::forward<V>(value));
+        if (!inserted.second)
+        {
+            *inserted.first = std::forward<V>(value);
+        }
+        return inserted;
+    }
+
+    Value& operator[](Key const& key)
+    {
+        return *try_emplace(key).first;
+    }
+
+    // Returns false if the key wasn't in the map
+    bool erase(Key const& key) noexcept
+    {
+        size_type hole = findSlot(key);
+        if (hole == npos)
+        {
+            return false;
+        }
+        slots_[hole].value.value.~Value();
+        // Moves back the elements that follow the hole and can go in it without being before the slot of their hash,
+        // so that they stay reachable from it without going through an empty slot
+        size_type const mask = capacity_ - 1;
+        for (size_type slot = (hole + 1) & mask; !isEmpty(slots_[slot].key); slot = (slot + 1) & mask)
+        {
+            size_type const home = hashKey(slots_[slot].key) & mask;
+            if (((slot - home) & mask) >= ((slot - hole) & mask))
+            {
+                ::new (static_cast<void*>(&slots_[hole].value.value)) Value(std::move(slots_[slot].value.value));
+                slots_[slot].value.value.~Value();
+                slots_[hole].key = slots_[slot].key;
+                hole = slot;
+            }
+        }
+        slots_[hole].key = invalidKey();
+        --size_;
+        return true;
+    }
+
+    // Calls f with the key and the value of each element, in no particular order
+    template <typename Function>
+    void for_each(Function&& f)
+    {
+        for (size_type slot = 0; slot < capacity_; ++slot)
+        {
+            if (!isEmpty(slots_[slot].key))
+            {
+                f(static_cast<Key const&>(slots_[slot].key), slots_[slot].value.value);
+            }
+        }
+    }
+
+    template <typename Function>
+    void for_each(Function&& f) const
+    {
+        for (size_type slot = 0; slot < capacity_; ++slot)
+        {
+            if (!isEmpty(slots_[slot].key))
+            {
+                f(slots_[slot].key, static_cast<Value const&>(slots_[slot].value.value));
+            }
+        }
+    }
+
+    FLUENT_INLINE size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    FLUENT_INLINE bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    // The number of slots, of which at most 3/4 are full
+    FLUENT_INLINE size_type capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    // Makes room for count elements without rehashing
+    void reserve(size_type count)
+    {
+        if (count > maxSize(capacity_))
+        {
+            rehash(hashMapCapacity(count + count / 3 + 1));
+        }
+    }
+
+    void clear() noexcept
+    {
+        destroyAll();
+        size_ = 0;
+    }
+
+private:
+    struct Slot
+    {
+        Key key = invalidKey();
+        Uninitialized<Value> value{};
+    };
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    FLUENT_INLINE static Key invalidKey() noexcept
+    {
+        return Key(TagOf<Key>::type::invalid_value);
+    }
+
+    FLUENT_INLINE static bool isEmpty(Key const& key) noexcept
+    {
+        return key.get() == TagOf<Key>::type::invalid_value;
+    }
+
+    FLUENT_INLINE static size_type maxSize(size_type capacity) noexcept
+    {
+        return capacity - capacity / 4;
+    }
+
+    FLUENT_INLINE size_type findSlot(Key const& key) const noexcept
+    {
+        if (size_ == 0 || isEmpty(key))
+        {
+            return npos;
+        }
+        size_type const mask = capacity_ - 1;
+        for (size_type slot = hashKey(key) & mask;; slot = (slot + 1) & mask)
+        {
+            if (equalKeys(slots_[slot].key, key))
+            {
+                return slot;
+            }
+            if (isEmpty(slots_[slot].key))
+            {
+                return npos;
+            }
+        }
+    }
+
+    void rehash(size_type capacity)
+    {
+        capacity = hashMapCapacity(capacity);
+        InvalidKeyHashMap rehashed;
+        rehashed.slots_.reset(new Slot[capacity]);
+        rehashed.capacity_ = capacity;
+        size_type const mask = capacity - 1;
+        for (size_type slot = 0; slot < capacity_; ++slot)
+        {
+            if (!isEmpty(slots_[slot].key))
+            {
+                size_type newSlot = hashKey(slots_[slot].key) & mask;
+                while (!isEmpty(rehashed.slots_[newSlot].key))
+                {
+                    newSlot = (newSlot + 1) & mask;
+                }
+                ::new (static_cast<void*>(&rehashed.slots_[newSlot].value.value))
+                    Value(std::move(slots_[slot].value.value));
+                rehashed.slots_[newSlot].key = slots_[slot].key;
+                ++rehashed.size_;
+            }
+        }
+        swap(rehashed);
+    }
+
+    void destroyAll() noexcept
+    {
+        for (size_type slot = 0; slot < capacity_; ++slot)
+        {
+            if (!isEmpty(slots_[slot].key))
+            {
+                slots_[slot].value.value.~Value();
+                slots_[slot].key = invalidKey();
+            }
+        }
+    }
+
+    std::unique_ptr<Slot[]> slots_ = nullptr;
+    size_type capacity_ = 0;
+    size_type size_ = 0;
+};
+} // namespace details
+
+// A hash map from a Hashable strong type to values, with open addressing in a single array of slots, for lookups
+// that std::unordered_map makes slow by allocating a node per element:
+//   using UserId = NamedType<std::uint64_t, struct UserIdTag, Hashable>;
+//   StrongHashMap<UserId, UserState> states;
+//   states[UserId{42}].visits += 1;
+//   if (UserState* state = states.find(UserId{7})) {...}
+// When the tag of the key reserves a value that no key holds, such as an invalid identifier, with
+//   struct UserIdTag { static constexpr std::uint64_t invalid_value = 0; };
+// the slots with that key are the empty ones, and the map needs no other memory, provided that moving the values
+// doesn't throw. Otherwise, the map keeps a control byte per slot, and compares those of several slots at once, with
+// SSE2 when it is available.
+// The elements are visited with for_each. Inserting and erasing invalidate the pointers to the values.
+template <typename Key, typename Value>
+using StrongHashMap = typename std::conditional<details::HasInvalidValue<Key>::value &&
+                                                    std::is_nothrow_move_constructible<Value>::value,
+                                                details::InvalidKeyHashMap<Key, Value>,
+                                                details::ControlByteHashMap<Key, Value>>::type;
+
+} // namespace fluent
+
+#endif
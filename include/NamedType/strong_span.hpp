@@ -0,0 +1,141 @@
+#ifndef STRONG_SPAN_HPP
+#define STRONG_SPAN_HPP
+
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#if defined(__has_include)
+#    if __has_include(<span>)
+#        include <span>
+#    endif
+#endif
+
+namespace fluent
+{
+
+// A strong type has the layout of its underlying type when it has the same size and alignment, and is standard
+// layout: the underlying value is then its first member, at the address of the strong type itself.
+// This holds whatever the skills, since they are empty bases. The trait also requires the strong type to be trivially
+// copyable, as the objects of the views of strong_span.hpp are created from the bytes of the other type.
+template <typename NamedType_>
+struct is_layout_compatible_with_underlying : std::false_type
+{
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct is_layout_compatible_with_underlying<NamedType<T, Parameter, Skills...>>
+    : std::integral_constant<
+          bool,
+          !std::is_reference<T>::value && sizeof(NamedType<T, Parameter, Skills...>) == sizeof(T) &&
+              alignof(NamedType<T, Parameter, Skills...>) == alignof(T) &&
+              std::is_standard_layout<NamedType<T, Parameter, Skills...>>::value &&
+              std::is_trivially_copyable<NamedType<T, Parameter, Skills...>>::value>
+{
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct is_layout_compatible_with_underlying<NamedType<T, Parameter, Skills...> const>
+    : is_layout_compatible_with_underlying<NamedType<T, Parameter, Skills...>>
+{
+};
+
+#if defined(__cpp_lib_span)
+
+namespace details
+{
+// With C++23, std::start_lifetime_as_array creates the objects of type To in the storage. Before, there is no standard
+// way to do so without copying, and the views rely on the compilers treating the laundered pointer as the one of
+// objects of type To, as the major ones do for trivially copyable types.
+template <typename To, typename From>
+FLUENT_INLINE To* reinterpret_array(From* data, std::size_t size) noexcept
+{
+#    if defined(__cpp_lib_start_lifetime_as)
+    return size == 0 ? reinterpret_cast<To*>(data) : std::start_lifetime_as_array<std::remove_const_t<To>>(data, size);
+#    else
+    (void)size;
+    return std::launder(reinterpret_cast<To*>(data));
+#    endif
+}
+
+template <typename T>
+struct IsSpan : std::false_type
+{
+};
+
+template <typename T, std::size_t Extent>
+struct IsSpan<std::span<T, Extent>> : std::true_type
+{
+};
+
+template <typename Container>
+using IsNotSpan = std::enable_if_t<!IsSpan<std::remove_cv_t<Container>>::value>;
+} // namespace details
+
+// Views a contiguous sequence of underlying values as a sequence of strong types, without copying them.
+// The returned span aliases the same storage, and is valid as long as it is. A span of const values gives a span of
+// const strong types:
+//   std::vector<std::uint64_t> ids = decode();
+//   std::span<UserId> userIds = as_strong_span<UserId>(std::span(ids));
+// Only one of the views of the storage may be used at a time: once the strong types are accessed, the underlying
+// values must not be until they are viewed again with as_raw_span. Before C++23 and std::start_lifetime_as_array, this
+// relies on the compiler rather than the standard, see details::reinterpret_array.
+template <typename Strong, typename T, std::size_t Extent>
+FLUENT_INLINE std::span<std::conditional_t<std::is_const<T>::value, Strong const, Strong>, Extent>
+as_strong_span(std::span<T, Extent> values) noexcept
+{
+    using Result = std::conditional_t<std::is_const<T>::value, Strong const, Strong>;
+    static_assert(
+        std::is_same<std::remove_cv_t<T>, typename Strong::UnderlyingType>::value,
+        "as_strong_span expects a span of the underlying type of the strong type");
+    static_assert(
+        is_layout_compatible_with_underlying<Strong>::value,
+        "the strong type doesn't have the layout of its underlying type");
+
+    return std::span<Result, Extent>(details::reinterpret_array<Result>(values.data(), values.size()), values.size());
+}
+
+template <typename Strong, typename Container, typename = details::IsNotSpan<Container>>
+FLUENT_INLINE auto as_strong_span(Container& values) noexcept -> decltype(as_strong_span<Strong>(std::span(values)))
+{
+    return as_strong_span<Strong>(std::span(values));
+}
+
+// Views a contiguous sequence of strong types as a sequence of their underlying values, without copying them, with the
+// same restrictions as as_strong_span: only one view may be used at a time, and before C++23 this relies on the
+// compiler.
+template <typename T, typename Parameter, template <typename> class... Skills, std::size_t Extent>
+FLUENT_INLINE std::span<T, Extent> as_raw_span(std::span<NamedType<T, Parameter, Skills...>, Extent> values) noexcept
+{
+    static_assert(
+        is_layout_compatible_with_underlying<NamedType<T, Parameter, Skills...>>::value,
+        "the strong type doesn't have the layout of its underlying type");
+
+    return std::span<T, Extent>(details::reinterpret_array<T>(values.data(), values.size()), values.size());
+}
+
+template <typename T, typename Parameter, template <typename> class... Skills, std::size_t Extent>
+FLUENT_INLINE std::span<T const, Extent>
+as_raw_span(std::span<NamedType<T, Parameter, Skills...> const, Extent> values) noexcept
+{
+    static_assert(
+        is_layout_compatible_with_underlying<NamedType<T, Parameter, Skills...>>::value,
+        "the strong type doesn't have the layout of its underlying type");
+
+    return std::span<T const, Extent>(details::reinterpret_array<T const>(values.data(), values.size()), values.size());
+}
+
+template <typename Container, typename = details::IsNotSpan<Container>>
+FLUENT_INLINE auto as_raw_span(Container& values) noexcept -> decltype(as_raw_span(std::span(values)))
+{
+    return as_raw_span(std::span(values));
+}
+
+#endif
+
+} // namespace fluent
+
+#endif
@@ -0,0 +1,498 @@
+#ifndef STRONG_VECTOR_HPP
+#define STRONG_VECTOR_HPP
+
+#include "named_type_impl.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Define FLUENT_CHECKED_INDICES to 1 to have the subscripts of StrongVector check their index and abort when it is out
+// of range, and to 0 to have them not check. By default they check in debug builds, where NDEBUG isn't defined, and
+// cost nothing in release builds.
+#if !defined(FLUENT_CHECKED_INDICES)
+#    if defined(NDEBUG)
+#        define FLUENT_CHECKED_INDICES 0
+#    else
+#        define FLUENT_CHECKED_INDICES 1
+#    endif
+#endif
+
+namespace fluent
+{
+
+namespace details
+{
+template <typename Index>
+struct IsIndex
+    : std::integral_constant<bool,
+                             std::is_integral<typename Index::UnderlyingType>::value &&
+                                 !std::is_same<typename Index::UnderlyingType, bool>::value>
+{
+};
+
+template <typename Index>
+FLUENT_INLINE constexpr Index toIndex(std::size_t position) noexcept
+{
+    return Index(static_cast<typename Index::UnderlyingType>(position));
+}
+
+template <typename Integer>
+FLUENT_INLINE constexpr std::size_t toPosition(Integer index) noexcept
+{
+    return static_cast<std::size_t>(index);
+}
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+FLUENT_INLINE constexpr std::size_t toPosition(NamedType<T, Parameter, Skills...> index) noexcept
+{
+    return toPosition(index.get());
+}
+
+[[noreturn]] inline void indexOutOfRange() noexcept
+{
+    std::abort();
+}
+} // namespace details
+
+// The strong indices from first included to last excluded, to iterate over the positions of a StrongVector:
+//   for (NodeIndex node : strong_iota(NodeIndex{1}, nodes.size())) {...}
+template <typename Index>
+class StrongIota
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Index;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Index const*;
+        using reference = Index;
+
+        FLUENT_INLINE constexpr iterator() noexcept : value_()
+        {
+        }
+
+        FLUENT_INLINE constexpr explicit iterator(typename Index::UnderlyingType value) noexcept : value_(value)
+        {
+        }
+
+        FLUENT_INLINE constexpr Index operator*() const noexcept
+        {
+            return Index(value_);
+        }
+
+        FLUENT_INLINE constexpr Index operator[](difference_type offset) const noexcept
+        {
+            return *(*this + offset);
+        }
+
+        FLUENT_INLINE constexpr iterator& operator++() noexcept
+        {
+            ++value_;
+            return *this;
+        }
+
+        FLUENT_INLINE constexpr iterator operator++(int) noexcept
+        {
+            iterator const previous = *this;
+            ++value_;
+            return previous;
+        }
+
+        FLUENT_INLINE constexpr iterator& operator--() noexcept
+        {
+            --value_;
+            return *this;
+        }
+
+        FLUENT_INLINE constexpr iterator operator--(int) noexcept
+        {
+            iterator const previous = *this;
+            --value_;
+            return previous;
+        }
+
+        FLUENT_INLINE constexpr iterator& operator+=(difference_type offset) noexcept
+        {
+            value_ = static_cast<typename Index::UnderlyingType>(static_cast<difference_type>(value_) + offset);
+            return *this;
+        }
+
+        FLUENT_INLINE constexpr iterator& operator-=(difference_type offset) noexcept
+        {
+            return *this += -offset;
+        }
+
+        FLUENT_INLINE friend constexpr iterator operator+(iterator it, difference_type offset) noexcept
+        {
+            return it += offset;
+        }
+
+        FLUENT_INLINE friend constexpr iterator operator+(difference_type offset, iterator it) noexcept
+        {
+            return it += offset;
+        }
+
+        FLUENT_INLINE friend constexpr iterator operator-(iterator it, difference_type offset) noexcept
+        {
+            return it -= offset;
+        }
+
+        FLUENT_INLINE friend constexpr difference_type operator-(iterator const& lhs, iterator const& rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.value_) - static_cast<difference_type>(rhs.value_);
+        }
+
+        FLUENT_INLINE friend constexpr bool operator==(iterator const& lhs, iterator const& rhs) noexcept
+        {
+            return lhs.value_ == rhs.value_;
+        }
+
+        FLUENT_INLINE friend constexpr bool operator!=(iterator const& lhs, iterator const& rhs) noexcept
+        {
+            return lhs.value_ != rhs.value_;
+        }
+
+        FLUENT_INLINE friend constexpr bool operator<(iterator const& lhs, iterator const& rhs) noexcept
+        {
+            return lhs.value_ < rhs.value_;
+        }
+
+        FLUENT_INLINE friend constexpr bool operator>(iterator const& lhs, iterator const& rhs) noexcept
+        {
+            return rhs < lhs;
+        }
+
+        FLUENT_INLINE friend constexpr bool operator<=(iterator const& lhs, iterator const& rhs) noexcept
+        {
+            return !(rhs < lhs);
+        }
+
+        FLUENT_INLINE friend constexpr bool operator>=(iterator const& lhs, iterator const& rhs) noexcept
+        {
+            return !(lhs < rhs);
+        }
+
+    private:
+        typename Index::UnderlyingType value_;
+    };
+
+    using const_iterator = iterator;
+
+    static_assert(details::IsIndex<Index>::value, "StrongIota needs a strong type over an integer");
+
+    FLUENT_INLINE constexpr StrongIota(Index first, Index last) noexcept : first_(first.get()), last_(last.get())
+    {
+    }
+
+    FLUENT_INLINE constexpr iterator begin() const noexcept
+    {
+        return iterator(first_);
+    }
+
+    FLUENT_INLINE constexpr iterator end() const noexcept
+    {
+        return iterator(last_);
+    }
+
+    FLUENT_INLINE constexpr std::size_t size() const noexcept
+    {
+        return static_cast<std::size_t>(last_ - first_);
+    }
+
+    FLUENT_INLINE constexpr bool empty() const noexcept
+    {
+        return first_ == last_;
+    }
+
+private:
+    typename Index::UnderlyingType first_;
+    typename Index::UnderlyingType last_;
+};
+
+template <typename Index>
+FLUENT_INLINE constexpr StrongIota<Index> strong_iota(Index first, Index last) noexcept
+{
+    return StrongIota<Index>(first, last);
+}
+
+// A std::vector whose elements are designated by a strong index, such as
+//   using NodeIndex = NamedType<std::uint32_t, struct NodeIndexTag, Comparable>;
+//   StrongVector<NodeIndex, Node> nodes;
+// Its subscript only takes the strong index it is declared with, so that the index of a node can't be used in the
+// vector of edges, and its size is given as a strong index too. The positions are iterated over with indices():
+//   for (NodeIndex node : nodes.indices()) {...}
+// It also has reserve, resize, push_back, emplace_back, pop_back, clear, front, back, data and the iterators of
+// std::vector, and get() gives the std::vector itself for the other operations. The subscripts check their index in
+// debug builds, see FLUENT_CHECKED_INDICES, and at() always checks it and throws std::out_of_range. The size is
+// checked in the same way not to go beyond the largest index.
+template <typename Index, typename Value, typename Allocator = std::allocator<Value>>
+class StrongVector
+{
+public:
+    using index_type = Index;
+    using value_type = Value;
+    using allocator_type = Allocator;
+    using vector_type = std::vector<Value, Allocator>;
+    using reference = typename vector_type::reference;
+    using const_reference = typename vector_type::const_reference;
+    using pointer = typename vector_type::pointer;
+    using const_pointer = typename vector_type::const_pointer;
+    using iterator = typename vector_type::iterator;
+    using const_iterator = typename vector_type::const_iterator;
+    using reverse_iterator = typename vector_type::reverse_iterator;
+    using const_reverse_iterator = typename vector_type::const_reverse_iterator;
+
+    static_assert(details::IsIndex<Index>::value, "the index of a StrongVector must be a strong type over an integer");
+
+    StrongVector() = default;
+
+    explicit StrongVector(Index count) : values_(details::toPosition(count))
+    {
+    }
+
+    StrongVector(Index count, Value const& value) : values_(details::toPosition(count), value)
+    {
+    }
+
+    StrongVector(std::initializer_list<Value> values) : values_(values)
+    {
+        checkSize(values_.size());
+    }
+
+    template <typename InputIterator>
+    StrongVector(InputIterator first, InputIterator last) : values_(first, last)
+    {
+        checkSize(values_.size());
+    }
+
+    explicit StrongVector(vector_type values) noexcept : values_(std::move(values))
+    {
+        checkSize(values_.size());
+    }
+
+    FLUENT_INLINE reference operator[](Index index) noexcept
+    {
+        check(index);
+        return values_[details::toPosition(index)];
+    }
+
+    FLUENT_INLINE const_reference operator[](Index index) const noexcept
+    {
+        check(index);
+        return values_[details::toPosition(index)];
+    }
+
+    reference at(Index index)
+    {
+        return values_.at(details::toPosition(index));
+    }
+
+    const_reference at(Index index) const
+    {
+        return values_.at(details::toPosition(index));
+    }
+
+    FLUENT_INLINE Index size() const noexcept
+    {
+        return details::toIndex<Index>(values_.size());
+    }
+
+    FLUENT_INLINE bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+
+    // The indices of the elements, from the first to the last
+    FLUENT_INLINE StrongIota<Index> indices() const noexcept
+    {
+        return StrongIota<Index>(Index(0), size());
+    }
+
+    void reserve(Index capacity)
+    {
+        values_.reserve(details::toPosition(capacity));
+    }
+
+    void resize(Index count)
+    {
+        values_.resize(details::toPosition(count));
+    }
+
+    void resize(Index count, Value const& value)
+    {
+        values_.resize(details::toPosition(count), value);
+    }
+
+    void push_back(Value const& value)
+    {
+        checkSize(values_.size() + 1);
+        values_.push_back(value);
+    }
+
+    void push_back(Value&& value)
+    {
+        checkSize(values_.size() + 1);
+        values_.push_back(std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        checkSize(values_.size() + 1);
+        values_.emplace_back(std::forward<Args>(args)...);
+        return values_.back();
+    }
+
+    void pop_back() noexcept
+    {
+        values_.pop_back();
+    }
+
+    void clear() noexcept
+    {
+        values_.clear();
+    }
+
+    FLUENT_INLINE reference front() noexcept
+    {
+        return values_.front();
+    }
+
+    FLUENT_INLINE const_reference front() const noexcept
+    {
+        return values_.front();
+    }
+
+    FLUENT_INLINE reference back() noexcept
+    {
+        return values_.back();
+    }
+
+    FLUENT_INLINE const_reference back() const noexcept
+    {
+        return values_.back();
+    }
+
+    FLUENT_INLINE pointer data() noexcept
+    {
+        return values_.data();
+    }
+
+    FLUENT_INLINE const_pointer data() const noexcept
+    {
+        return values_.data();
+    }
+
+    FLUENT_INLINE iterator begin() noexcept
+    {
+        return values_.begin();
+    }
+
+    FLUENT_INLINE const_iterator begin() const noexcept
+    {
+        return values_.begin();
+    }
+
+    FLUENT_INLINE const_iterator cbegin() const noexcept
+    {
+        return values_.cbegin();
+    }
+
+    FLUENT_INLINE iterator end() noexcept
+    {
+        return values_.end();
+    }
+
+    FLUENT_INLINE const_iterator end() const noexcept
+    {
+        return values_.end();
+    }
+
+    FLUENT_INLINE const_iterator cend() const noexcept
+    {
+        return values_.cend();
+    }
+
+    FLUENT_INLINE reverse_iterator rbegin() noexcept
+    {
+        return values_.rbegin();
+    }
+
+    FLUENT_INLINE const_reverse_iterator rbegin() const noexcept
+    {
+        return values_.rbegin();
+    }
+
+    FLUENT_INLINE reverse_iterator rend() noexcept
+    {
+        return values_.rend();
+    }
+
+    FLUENT_INLINE const_reverse_iterator rend() const noexcept
+    {
+        return values_.rend();
+    }
+
+    // The std::vector that holds the elements, to pass them to the code that doesn't know about strong indices
+    FLUENT_INLINE vector_type& get() noexcept
+    {
+        return values_;
+    }
+
+    FLUENT_INLINE vector_type const& get() const noexcept
+    {
+        return values_;
+    }
+
+    friend bool operator==(StrongVector const& lhs, StrongVector const& rhs)
+    {
+        return lhs.values_ == rhs.values_;
+    }
+
+    friend bool operator!=(StrongVector const& lhs, StrongVector const& rhs)
+    {
+        return lhs.values_ != rhs.values_;
+    }
+
+private:
+    FLUENT_INLINE void check(Index index) const noexcept
+    {
+#if FLUENT_CHECKED_INDICES
+        if (details::toPosition(index) >= values_.size())
+        {
+            details::indexOutOfRange();
+        }
+#else
+        (void)index;
+#endif
+    }
+
+    // Beyond the largest index, the elements couldn't be designated, and the size would overflow
+    FLUENT_INLINE static void checkSize(std::size_t size) noexcept
+    {
+#if FLUENT_CHECKED_INDICES
+        if (size > details::toPosition(std::numeric_limits<typename Index::UnderlyingType>::max()))
+        {
+            details::indexOutOfRange();
+        }
+#else
+        (void)size;
+#endif
+    }
+
+    vector_type values_;
+};
+
+} // namespace fluent
+
+#endif
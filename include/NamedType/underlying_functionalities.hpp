@@ -3,10 +3,28 @@
 
 #include "crtp.hpp"
 #include "named_type_impl.hpp"
+#include "printable.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <iostream>
 #include <memory>
+#include <type_traits>
+
+#if defined(__cpp_impl_three_way_comparison) && __cpp_impl_three_way_comparison >= 201907L
+#    include <compare>
+#    define FLUENT_HAS_THREE_WAY_COMPARISON 1
+#else
+#    define FLUENT_HAS_THREE_WAY_COMPARISON 0
+#endif
+
+#if defined(__clang__) || defined(__GNUC__)
+#    define IGNORE_FLOAT_EQUAL_BEGIN _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Wfloat-equal\"")
+#    define IGNORE_FLOAT_EQUAL_END _Pragma("GCC diagnostic pop")
+#else
+#    define IGNORE_FLOAT_EQUAL_BEGIN /* Nothing */
+#    define IGNORE_FLOAT_EQUAL_END   /* Nothing */
+#endif
 
 namespace fluent
 {
@@ -16,7 +34,7 @@ struct PreIncrementable : crtp<T, PreIncrementable>
 {
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
-    constexpr T& operator++()
+    FLUENT_INLINE constexpr T& operator++() noexcept(noexcept(++this->underlying().get()))
     {
         ++this->underlying().get();
         return this->underlying();
@@ -30,9 +48,9 @@ struct PostIncrementable : crtp<T, PostIncrementable>
 {
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
-    constexpr T operator++(int)
+    FLUENT_INLINE constexpr T operator++(int) noexcept(noexcept(T(this->underlying().get()++)))
     {
-        return this->underlying().get()++;
+        return T(this->underlying().get()++);
     }
 
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_END
@@ -43,7 +61,7 @@ struct PreDecrementable : crtp<T, PreDecrementable>
 {
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
-    constexpr T& operator--()
+    FLUENT_INLINE constexpr T& operator--() noexcept(noexcept(--this->underlying().get()))
     {
         --this->underlying().get();
         return this->underlying();
@@ -57,9 +75,9 @@ struct PostDecrementable : crtp<T, PostDecrementable>
 {
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
 
-    constexpr T operator--(int)
+    FLUENT_INLINE constexpr T operator--(int) noexcept(noexcept(T(this->underlying().get()--)))
     {
-        return this->underlying().get()--;
+        return T(this->underlying().get()--);
     }
 
     IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_END
@@ -68,11 +86,12 @@ struct PostDecrementable : crtp<T, PostDecrementable>
 template <typename T>
 struct BinaryAddable : crtp<T, BinaryAddable>
 {
-    constexpr T operator+(T const& other) const
+    FLUENT_INLINE constexpr T operator+(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() + other.get())))
     {
         return T(this->underlying().get() + other.get());
     }
-    constexpr T& operator+=(T const& other)
+    FLUENT_INLINE constexpr T& operator+=(T const& other) noexcept(noexcept(this->underlying().get() += other.get()))
     {
         this->underlying().get() += other.get();
         return this->underlying();
@@ -82,27 +101,42 @@ struct BinaryAddable : crtp<T, BinaryAddable>
 template <typename T>
 struct UnaryAddable : crtp<T, UnaryAddable>
 {
-    constexpr T operator+() const
+    FLUENT_INLINE constexpr T operator+() const noexcept(noexcept(T(+this->underlying().get())))
     {
         return T(+this->underlying().get());
     }
 };
 
+// The operators of BinaryAddable and UnaryAddable in a single skill, rather than inheriting from both: every base class
+// template would be one more instantiation, with its own symbols and debug information, for each strong type.
 template <typename T>
-struct Addable
-    : BinaryAddable<T>
-    , UnaryAddable<T>
+struct Addable : crtp<T, Addable>
 {
+    FLUENT_INLINE constexpr T operator+(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() + other.get())))
+    {
+        return T(this->underlying().get() + other.get());
+    }
+    FLUENT_INLINE constexpr T& operator+=(T const& other) noexcept(noexcept(this->underlying().get() += other.get()))
+    {
+        this->underlying().get() += other.get();
+        return this->underlying();
+    }
+    FLUENT_INLINE constexpr T operator+() const noexcept(noexcept(T(+this->underlying().get())))
+    {
+        return T(+this->underlying().get());
+    }
 };
 
 template <typename T>
 struct BinarySubtractable : crtp<T, BinarySubtractable>
 {
-    constexpr T operator-(T const& other) const
+    FLUENT_INLINE constexpr T operator-(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() - other.get())))
     {
         return T(this->underlying().get() - other.get());
     }
-    constexpr T& operator-=(T const& other)
+    FLUENT_INLINE constexpr T& operator-=(T const& other) noexcept(noexcept(this->underlying().get() -= other.get()))
     {
         this->underlying().get() -= other.get();
         return this->underlying();
@@ -112,27 +146,42 @@ struct BinarySubtractable : crtp<T, BinarySubtractable>
 template <typename T>
 struct UnarySubtractable : crtp<T, UnarySubtractable>
 {
-    constexpr T operator-() const
+    FLUENT_INLINE constexpr T operator-() const noexcept(noexcept(T(-this->underlying().get())))
     {
         return T(-this->underlying().get());
     }
 };
 
+// The operators of BinarySubtractable and UnarySubtractable in a single skill, for the same reason as Addable
 template <typename T>
-struct Subtractable
-    : BinarySubtractable<T>
-    , UnarySubtractable<T>
+struct Subtractable : crtp<T, Subtractable>
 {
+    FLUENT_INLINE constexpr T operator-(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() - other.get())))
+    {
+        return T(this->underlying().get() - other.get());
+    }
+    FLUENT_INLINE constexpr T& operator-=(T const& other) noexcept(noexcept(this->underlying().get() -= other.get()))
+    {
+        this->underlying().get() -= other.get();
+        return this->underlying();
+    }
+    FLUENT_INLINE constexpr T operator-() const noexcept(noexcept(T(-this->underlying().get())))
+    {
+        return T(-this->underlying().get());
+    }
 };
 
 template <typename T>
 struct Multiplicable : crtp<T, Multiplicable>
 {
-    constexpr T operator*(T const& other) const
+    // A friend rather than a member, so that NamedType's dereferencing operator* doesn't hide it
+    friend FLUENT_INLINE constexpr T operator*(Multiplicable<T> const& self, T const& other)
+        noexcept(noexcept(T(self.underlying().get() * other.get())))
     {
-        return T(this->underlying().get() * other.get());
+        return T(self.underlying().get() * other.get());
     }
-    constexpr T& operator*=(T const& other)
+    FLUENT_INLINE constexpr T& operator*=(T const& other) noexcept(noexcept(this->underlying().get() *= other.get()))
     {
         this->underlying().get() *= other.get();
         return this->underlying();
@@ -142,11 +191,12 @@ struct Multiplicable : crtp<T, Multiplicable>
 template <typename T>
 struct Divisible : crtp<T, Divisible>
 {
-    constexpr T operator/(T const& other) const
+    FLUENT_INLINE constexpr T operator/(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() / other.get())))
     {
         return T(this->underlying().get() / other.get());
     }
-    constexpr T& operator/=(T const& other)
+    FLUENT_INLINE constexpr T& operator/=(T const& other) noexcept(noexcept(this->underlying().get() /= other.get()))
     {
         this->underlying().get() /= other.get();
         return this->underlying();
@@ -156,11 +206,12 @@ struct Divisible : crtp<T, Divisible>
 template <typename T>
 struct Modulable : crtp<T, Modulable>
 {
-    constexpr T operator%(T const& other) const
+    FLUENT_INLINE constexpr T operator%(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() % other.get())))
     {
         return T(this->underlying().get() % other.get());
     }
-    constexpr T& operator%=(T const& other)
+    FLUENT_INLINE constexpr T& operator%=(T const& other) noexcept(noexcept(this->underlying().get() %= other.get()))
     {
         this->underlying().get() %= other.get();
         return this->underlying();
@@ -170,7 +221,7 @@ struct Modulable : crtp<T, Modulable>
 template <typename T>
 struct BitWiseInvertable : crtp<T, BitWiseInvertable>
 {
-    constexpr T operator~() const
+    FLUENT_INLINE constexpr T operator~() const noexcept(noexcept(T(~this->underlying().get())))
     {
         return T(~this->underlying().get());
     }
@@ -179,11 +230,12 @@ struct BitWiseInvertable : crtp<T, BitWiseInvertable>
 template <typename T>
 struct BitWiseAndable : crtp<T, BitWiseAndable>
 {
-    constexpr T operator&(T const& other) const
+    FLUENT_INLINE constexpr T operator&(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() & other.get())))
     {
         return T(this->underlying().get() & other.get());
     }
-    constexpr T& operator&=(T const& other)
+    FLUENT_INLINE constexpr T& operator&=(T const& other) noexcept(noexcept(this->underlying().get() &= other.get()))
     {
         this->underlying().get() &= other.get();
         return this->underlying();
@@ -193,11 +245,12 @@ struct BitWiseAndable : crtp<T, BitWiseAndable>
 template <typename T>
 struct BitWiseOrable : crtp<T, BitWiseOrable>
 {
-    constexpr T operator|(T const& other) const
+    FLUENT_INLINE constexpr T operator|(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() | other.get())))
     {
         return T(this->underlying().get() | other.get());
     }
-    constexpr T& operator|=(T const& other)
+    FLUENT_INLINE constexpr T& operator|=(T const& other) noexcept(noexcept(this->underlying().get() |= other.get()))
     {
         this->underlying().get() |= other.get();
         return this->underlying();
@@ -207,11 +260,12 @@ struct BitWiseOrable : crtp<T, BitWiseOrable>
 template <typename T>
 struct BitWiseXorable : crtp<T, BitWiseXorable>
 {
-    constexpr T operator^(T const& other) const
+    FLUENT_INLINE constexpr T operator^(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() ^ other.get())))
     {
         return T(this->underlying().get() ^ other.get());
     }
-    constexpr T& operator^=(T const& other)
+    FLUENT_INLINE constexpr T& operator^=(T const& other) noexcept(noexcept(this->underlying().get() ^= other.get()))
     {
         this->underlying().get() ^= other.get();
         return this->underlying();
@@ -221,11 +275,12 @@ struct BitWiseXorable : crtp<T, BitWiseXorable>
 template <typename T>
 struct BitWiseLeftShiftable : crtp<T, BitWiseLeftShiftable>
 {
-    constexpr T operator<<(T const& other) const
+    FLUENT_INLINE constexpr T operator<<(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() << other.get())))
     {
         return T(this->underlying().get() << other.get());
     }
-    constexpr T& operator<<=(T const& other)
+    FLUENT_INLINE constexpr T& operator<<=(T const& other) noexcept(noexcept(this->underlying().get() <<= other.get()))
     {
         this->underlying().get() <<= other.get();
         return this->underlying();
@@ -235,11 +290,12 @@ struct BitWiseLeftShiftable : crtp<T, BitWiseLeftShiftable>
 template <typename T>
 struct BitWiseRightShiftable : crtp<T, BitWiseRightShiftable>
 {
-    constexpr T operator>>(T const& other) const
+    FLUENT_INLINE constexpr T operator>>(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() >> other.get())))
     {
         return T(this->underlying().get() >> other.get());
     }
-    constexpr T& operator>>=(T const& other)
+    FLUENT_INLINE constexpr T& operator>>=(T const& other) noexcept(noexcept(this->underlying().get() >>= other.get()))
     {
         this->underlying().get() >>= other.get();
         return this->underlying();
@@ -249,127 +305,618 @@ struct BitWiseRightShiftable : crtp<T, BitWiseRightShiftable>
 template <typename T>
 struct Comparable : crtp<T, Comparable>
 {
-    constexpr bool operator<(T const& other) const
+    FLUENT_INLINE constexpr bool operator<(T const& other) const
+        noexcept(noexcept(this->underlying().get() < other.get()))
     {
         return this->underlying().get() < other.get();
     }
-    constexpr bool operator>(T const& other) const
+    FLUENT_INLINE constexpr bool operator>(T const& other) const
+        noexcept(noexcept(other.get() < this->underlying().get()))
     {
         return other.get() < this->underlying().get();
     }
-    constexpr bool operator<=(T const& other) const
+    FLUENT_INLINE constexpr bool operator<=(T const& other) const
+        noexcept(noexcept(other.get() < this->underlying().get()))
     {
         return !(other.get() < this->underlying().get());
     }
-    constexpr bool operator>=(T const& other) const
+    FLUENT_INLINE constexpr bool operator>=(T const& other) const
+        noexcept(noexcept(this->underlying().get() < other.get()))
     {
         return !(*this < other);
     }
-    friend constexpr bool operator==(Comparable<T> const& self, T const& other)
+    friend FLUENT_INLINE constexpr bool operator==(Comparable<T> const& self, T const& other)
+        noexcept(noexcept(self.underlying().get() < other.get()) && noexcept(other.get() < self.underlying().get()))
     {
         return !(self < other) && !(other.get() < self.underlying().get());
     }
-    constexpr bool operator!=(T const& other) const
+#if !FLUENT_HAS_THREE_WAY_COMPARISON
+    // With C++20, a != b is rewritten into !(a == b)
+    FLUENT_INLINE constexpr bool operator!=(T const& other) const noexcept(noexcept(*this == other))
     {
         return !(*this == other);
     }
+#endif
 };
 
+// Forwards the comparisons to the ones of the underlying type, instead of deducing them all from operator<.
+// Equality costs one comparison of the underlying values instead of two, and follows the semantics of the underlying
+// type, for instance for NaNs. With C++20, the relational operators are derived from the underlying operator<=>.
 template <typename T>
-struct Printable : crtp<T, Printable>
+struct ThreeWayComparable : crtp<T, ThreeWayComparable>
 {
-    void print(std::ostream& os) const
+    IGNORE_FLOAT_EQUAL_BEGIN
+
+    friend FLUENT_INLINE constexpr bool operator==(ThreeWayComparable<T> const& self, T const& other)
+        noexcept(noexcept(self.underlying().get() == other.get()))
     {
-        os << this->underlying().get();
+        return self.underlying().get() == other.get();
+    }
+
+    IGNORE_FLOAT_EQUAL_END
+
+#if FLUENT_HAS_THREE_WAY_COMPARISON
+    friend FLUENT_INLINE constexpr auto operator<=>(ThreeWayComparable<T> const& self, T const& other)
+        noexcept(noexcept(self.underlying().get() <=> other.get()))
+    {
+        return self.underlying().get() <=> other.get();
+    }
+#else
+    IGNORE_FLOAT_EQUAL_BEGIN
+
+    FLUENT_INLINE constexpr bool operator!=(T const& other) const
+        noexcept(noexcept(this->underlying().get() != other.get()))
+    {
+        return this->underlying().get() != other.get();
+    }
+
+    IGNORE_FLOAT_EQUAL_END
+
+    FLUENT_INLINE constexpr bool operator<(T const& other) const
+        noexcept(noexcept(this->underlying().get() < other.get()))
+    {
+        return this->underlying().get() < other.get();
+    }
+    FLUENT_INLINE constexpr bool operator>(T const& other) const
+        noexcept(noexcept(this->underlying().get() > other.get()))
+    {
+        return this->underlying().get() > other.get();
     }
+    FLUENT_INLINE constexpr bool operator<=(T const& other) const
+        noexcept(noexcept(this->underlying().get() <= other.get()))
+    {
+        return this->underlying().get() <= other.get();
+    }
+    FLUENT_INLINE constexpr bool operator>=(T const& other) const
+        noexcept(noexcept(this->underlying().get() >= other.get()))
+    {
+        return this->underlying().get() >= other.get();
+    }
+#endif
 };
 
+namespace details
+{
+// Only named in noexcept expressions, to know whether the implicit conversion to Destination throws
+template <typename Destination>
+void convertImplicitly(Destination) noexcept;
+} // namespace details
+
 template <typename Destination>
 struct ImplicitlyConvertibleTo
 {
     template <typename T>
     struct templ : crtp<T, templ>
     {
-        operator Destination() const
+        FLUENT_INLINE operator Destination() const
+            noexcept(noexcept(details::convertImplicitly<Destination>(this->underlying().get())))
         {
             return this->underlying().get();
         }
     };
 };
 
-template <typename T, typename Parameter, template <typename> class... Skills>
-std::ostream& operator<<(std::ostream& os, NamedType<T, Parameter, Skills...> const& object)
-{
-    object.print(os);
-    return os;
-}
-
 template <typename T>
 struct Hashable
 {
     static constexpr bool is_hashable = true;
 };
 
+// Hashes the underlying value with std::hash
+struct StdHashMixer
+{
+    template <typename T>
+    FLUENT_INLINE std::size_t operator()(T const& value) const noexcept(noexcept(std::hash<T>()(value)))
+    {
+        return std::hash<T>()(value);
+    }
+};
+
+// Spreads the bits of the underlying value over the whole hash, with the multiply and fold of wyhash.
+// std::hash is the identity for integers in some standard libraries, which clusters consecutive or aligned
+// identifiers in the hash tables that use the low bits of the hash, such as open addressing tables with a power of
+// two number of buckets. Values that are not integral are first hashed with std::hash, then mixed.
+struct AvalancheHashMixer
+{
+    template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    FLUENT_INLINE constexpr std::size_t operator()(T const& value) const noexcept
+    {
+        return mix(value);
+    }
+
+    template <typename T, typename std::enable_if<!std::is_integral<T>::value, int>::type = 0>
+    FLUENT_INLINE std::size_t operator()(T const& value) const noexcept(noexcept(std::hash<T>()(value)))
+    {
+        return mix(std::hash<T>()(value));
+    }
+
+    FLUENT_INLINE static constexpr std::size_t mix(std::uint64_t value) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 uint128;
+        uint128 const product = uint128{value ^ 0xa0761d6478bd642fULL} * 0xe7037ed1a0b428dbULL;
+        std::uint64_t const hash = static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#else
+        // Without 128 bits multiplication, the finalizer of MurmurHash3
+        std::uint64_t hash = value;
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+#endif
+#if SIZE_MAX >= UINT64_MAX
+        return hash;
+#else
+        return static_cast<std::size_t>(hash ^ (hash >> 32));
+#endif
+    }
+};
+
+// Makes the strong type hashable with std::hash, which then returns Mixer()(x.get()).
+// A Mixer has a const call operator taking the underlying value and returning a std::size_t.
+template <typename Mixer>
+struct HashableWith
+{
+    template <typename T>
+    struct templ
+    {
+        using hash_mixer = Mixer;
+    };
+};
+
+template <typename T>
+using MixedHashable = typename HashableWith<AvalancheHashMixer>::template templ<T>;
+
+namespace details
+{
+template <typename... Ts>
+struct make_void
+{
+    using type = void;
+};
+
+template <typename NamedType_, typename = void>
+struct HasHashMixer : std::false_type
+{
+};
+
+template <typename NamedType_>
+struct HasHashMixer<NamedType_, typename make_void<typename NamedType_::hash_mixer>::type> : std::true_type
+{
+};
+
+template <typename... SkillTypes>
+constexpr std::size_t countHashMixers()
+{
+    constexpr bool hasHashMixer[] = {HasHashMixer<SkillTypes>::value..., false};
+    std::size_t count = 0;
+    for (std::size_t index = 0; index < sizeof...(SkillTypes); ++index)
+    {
+        count += hasHashMixer[index] ? 1 : 0;
+    }
+    return count;
+}
+
+// The number of skills of a strong type that declare a hash_mixer. With more than one, NamedType::hash_mixer is
+// ambiguous, and the strong type would silently fall back on StdHashMixer.
+template <typename NamedType_>
+struct HashMixerCount : std::integral_constant<std::size_t, HasHashMixer<NamedType_>::value ? 1 : 0>
+{
+};
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct HashMixerCount<NamedType<T, Parameter, Skills...>>
+    : std::integral_constant<std::size_t,
+                             countHashMixers<Skills<typename StrongType<NamedType<T, Parameter, Skills...>,
+                                                                        Parameter>::type>...>()>
+{
+};
+
+template <typename NamedType_, typename = void>
+struct HashMixer
+{
+    static_assert(HashMixerCount<NamedType_>::value <= 1, "a strong type can have only one skill with a hash_mixer");
+    using type = StdHashMixer;
+};
+
+template <typename NamedType_>
+struct HashMixer<NamedType_, typename make_void<typename NamedType_::hash_mixer>::type>
+{
+    using type = typename NamedType_::hash_mixer;
+};
+
+template <typename NamedType_, typename = void>
+struct HasHashableSkill : std::false_type
+{
+};
+
+template <typename NamedType_>
+struct HasHashableSkill<NamedType_, typename make_void<decltype(NamedType_::is_hashable)>::type>
+    : std::integral_constant<bool, NamedType_::is_hashable>
+{
+};
+
+template <typename NamedType_>
+struct IsHashable
+    : std::integral_constant<bool, HasHashableSkill<NamedType_>::value || HasHashMixer<NamedType_>::value>
+{
+    static_assert(HashMixerCount<NamedType_>::value <= 1, "a strong type can have only one skill with a hash_mixer");
+};
+} // namespace details
+
+// Transparent function objects for the containers keyed by a strong type, that let them look up with a strong type
+// of the same tag and a different underlying type, without building a key.
+// For instance a std::map<Name, V, TransparentLess<Name>> or a
+// std::unordered_map<Name, V, TransparentHash<Name>, TransparentEqualTo<Name>> with
+//   using Name = NamedType<std::string, struct NameTag, Hashable>;
+// can be searched with a NamedType<std::string_view, struct NameTag> without allocating a std::string.
+// The hash of the other underlying type has to be equal to the one of the key for equal values, which is the case for
+// std::hash of std::string and std::string_view.
+
+template <typename NamedType_>
+struct TransparentHash;
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct TransparentHash<NamedType<T, Parameter, Skills...>>
+{
+    using is_transparent = void;
+    using Mixer = typename details::HashMixer<NamedType<T, Parameter, Skills...>>::type;
+
+    template <typename U, template <typename> class... OtherSkills>
+    FLUENT_INLINE std::size_t operator()(NamedType<U, Parameter, OtherSkills...> const& x) const
+        noexcept(noexcept(Mixer()(x.get())))
+    {
+        return Mixer()(x.get());
+    }
+};
+
 template <typename NamedType_>
-struct FunctionCallable;
+struct TransparentEqualTo;
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct TransparentEqualTo<NamedType<T, Parameter, Skills...>>
+{
+    using is_transparent = void;
+
+    IGNORE_FLOAT_EQUAL_BEGIN
+
+    template <typename U1, template <typename> class... Skills1, typename U2, template <typename> class... Skills2>
+    FLUENT_INLINE constexpr bool
+    operator()(NamedType<U1, Parameter, Skills1...> const& lhs, NamedType<U2, Parameter, Skills2...> const& rhs) const
+        noexcept(noexcept(lhs.get() == rhs.get()))
+    {
+        return lhs.get() == rhs.get();
+    }
+
+    IGNORE_FLOAT_EQUAL_END
+};
+
+template <typename NamedType_>
+struct TransparentLess;
+
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct TransparentLess<NamedType<T, Parameter, Skills...>>
+{
+    using is_transparent = void;
+
+    template <typename U1, template <typename> class... Skills1, typename U2, template <typename> class... Skills2>
+    FLUENT_INLINE constexpr bool
+    operator()(NamedType<U1, Parameter, Skills1...> const& lhs, NamedType<U2, Parameter, Skills2...> const& rhs) const
+        noexcept(noexcept(lhs.get() < rhs.get()))
+    {
+        return lhs.get() < rhs.get();
+    }
+};
+
+// The derived classes of NamedType are still incomplete when their skills are instantiated: the types of their
+// operators are deduced when they are used
+template <typename NamedType_>
+struct FunctionCallable : crtp<NamedType_, FunctionCallable>
+{
+    FLUENT_INLINE constexpr operator auto const&() const noexcept
+    {
+        return this->underlying().get();
+    }
+    FLUENT_INLINE constexpr operator auto&() noexcept
+    {
+        return this->underlying().get();
+    }
+};
 
 template <typename T, typename Parameter, template <typename> class... Skills>
 struct FunctionCallable<NamedType<T, Parameter, Skills...>> : crtp<NamedType<T, Parameter, Skills...>, FunctionCallable>
 {
-    constexpr operator T const&() const
+    FLUENT_INLINE constexpr operator T const&() const noexcept
     {
         return this->underlying().get();
     }
-    constexpr operator T&()
+    FLUENT_INLINE constexpr operator T&() noexcept
     {
         return this->underlying().get();
     }
 };
 
 template <typename NamedType_>
-struct MethodCallable;
+struct MethodCallable : crtp<NamedType_, MethodCallable>
+{
+    FLUENT_INLINE constexpr auto operator->() const noexcept
+    {
+        return std::addressof(this->underlying().get());
+    }
+    FLUENT_INLINE constexpr auto operator->() noexcept
+    {
+        return std::addressof(this->underlying().get());
+    }
+};
 
 template <typename T, typename Parameter, template <typename> class... Skills>
 struct MethodCallable<NamedType<T, Parameter, Skills...>> : crtp<NamedType<T, Parameter, Skills...>, MethodCallable>
 {
-    constexpr std::remove_reference_t<T> const* operator->() const
+    FLUENT_INLINE constexpr std::remove_reference_t<T> const* operator->() const noexcept
     {
         return std::addressof(this->underlying().get());
     }
-    constexpr std::remove_reference_t<T>* operator->()
+    FLUENT_INLINE constexpr std::remove_reference_t<T>* operator->() noexcept
     {
         return std::addressof(this->underlying().get());
     }
 };
 
+// The operators of FunctionCallable and MethodCallable in a single skill, for the same reason as Addable
 template <typename NamedType_>
-struct Callable
-    : FunctionCallable<NamedType_>
-    , MethodCallable<NamedType_>
+struct Callable : crtp<NamedType_, Callable>
 {
+    FLUENT_INLINE constexpr operator auto const&() const noexcept
+    {
+        return this->underlying().get();
+    }
+    FLUENT_INLINE constexpr operator auto&() noexcept
+    {
+        return this->underlying().get();
+    }
+    FLUENT_INLINE constexpr auto operator->() const noexcept
+    {
+        return std::addressof(this->underlying().get());
+    }
+    FLUENT_INLINE constexpr auto operator->() noexcept
+    {
+        return std::addressof(this->underlying().get());
+    }
 };
 
+template <typename T, typename Parameter, template <typename> class... Skills>
+struct Callable<NamedType<T, Parameter, Skills...>> : crtp<NamedType<T, Parameter, Skills...>, Callable>
+{
+    FLUENT_INLINE constexpr operator T const&() const noexcept
+    {
+        return this->underlying().get();
+    }
+    FLUENT_INLINE constexpr operator T&() noexcept
+    {
+        return this->underlying().get();
+    }
+    FLUENT_INLINE constexpr std::remove_reference_t<T> const* operator->() const noexcept
+    {
+        return std::addressof(this->underlying().get());
+    }
+    FLUENT_INLINE constexpr std::remove_reference_t<T>* operator->() noexcept
+    {
+        return std::addressof(this->underlying().get());
+    }
+};
+
+// The operators of the incrementable, addable, subtractable, multiplicable, divisible, modulable, bitwise and
+// Comparable skills, with the ones of Printable and Hashable, in a single skill. Inheriting from each of them would
+// instantiate about forty class templates for each strong type, against two here.
 template <typename T>
-struct Arithmetic
-    : PreIncrementable<T>
-    , PostIncrementable<T>
-    , PreDecrementable<T>
-    , PostDecrementable<T>
-    , Addable<T>
-    , Subtractable<T>
-    , Multiplicable<T>
-    , Divisible<T>
-    , Modulable<T>
-    , BitWiseInvertable<T>
-    , BitWiseAndable<T>
-    , BitWiseOrable<T>
-    , BitWiseXorable<T>
-    , BitWiseLeftShiftable<T>
-    , BitWiseRightShiftable<T>
-    , Comparable<T>
-    , Printable<T>
-    , Hashable<T>
+struct Arithmetic : crtp<T, Arithmetic>
 {
+    static constexpr bool is_hashable = true;
+
+    IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_BEGIN
+
+    FLUENT_INLINE constexpr T& operator++() noexcept(noexcept(++this->underlying().get()))
+    {
+        ++this->underlying().get();
+        return this->underlying();
+    }
+    FLUENT_INLINE constexpr T operator++(int) noexcept(noexcept(T(this->underlying().get()++)))
+    {
+        return T(this->underlying().get()++);
+    }
+    FLUENT_INLINE constexpr T& operator--() noexcept(noexcept(--this->underlying().get()))
+    {
+        --this->underlying().get();
+        return this->underlying();
+    }
+    FLUENT_INLINE constexpr T operator--(int) noexcept(noexcept(T(this->underlying().get()--)))
+    {
+        return T(this->underlying().get()--);
+    }
+
+    IGNORE_SHOULD_RETURN_REFERENCE_TO_THIS_END
+
+    FLUENT_INLINE constexpr T operator+(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() + other.get())))
+    {
+        return T(this->underlying().get() + other.get());
+    }
+    FLUENT_INLINE constexpr T& operator+=(T const& other) noexcept(noexcept(this->underlying().get() += other.get()))
+    {
+        this->underlying().get() += other.get();
+        return this->underlying();
+    }
+    FLUENT_INLINE constexpr T operator+() const noexcept(noexcept(T(+this->underlying().get())))
+    {
+        return T(+this->underlying().get());
+    }
+
+    FLUENT_INLINE constexpr T operator-(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() - other.get())))
+    {
+        return T(this->underlying().get() - other.get());
+    }
+    FLUENT_INLINE constexpr T& operator-=(T const& other) noexcept(noexcept(this->underlying().get() -= other.get()))
+    {
+        this->underlying().get() -= other.get();
+        return this->underlying();
+    }
+    FLUENT_INLINE constexpr T operator-() const noexcept(noexcept(T(-this->underlying().get())))
+    {
+        return T(-this->underlying().get());
+    }
+
+    // A friend rather than a member, so that NamedType's dereferencing operator* doesn't hide it
+    friend FLUENT_INLINE constexpr T operator*(Arithmetic<T> const& self, T const& other)
+        noexcept(noexcept(T(self.underlying().get() * other.get())))
+    {
+        return T(self.underlying().get() * other.get());
+    }
+    FLUENT_INLINE constexpr T& operator*=(T const& other) noexcept(noexcept(this->underlying().get() *= other.get()))
+    {
+        this->underlying().get() *= other.get();
+        return this->underlying();
+    }
+
+    FLUENT_INLINE constexpr T operator/(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() / other.get())))
+    {
+        return T(this->underlying().get() / other.get());
+    }
+    FLUENT_INLINE constexpr T& operator/=(T const& other) noexcept(noexcept(this->underlying().get() /= other.get()))
+    {
+        this->underlying().get() /= other.get();
+        return this->underlying();
+    }
+
+    FLUENT_INLINE constexpr T operator%(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() % other.get())))
+    {
+        return T(this->underlying().get() % other.get());
+    }
+    FLUENT_INLINE constexpr T& operator%=(T const& other) noexcept(noexcept(this->underlying().get() %= other.get()))
+    {
+        this->underlying().get() %= other.get();
+        return this->underlying();
+    }
+
+    FLUENT_INLINE constexpr T operator~() const noexcept(noexcept(T(~this->underlying().get())))
+    {
+        return T(~this->underlying().get());
+    }
+
+    FLUENT_INLINE constexpr T operator&(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() & other.get())))
+    {
+        return T(this->underlying().get() & other.get());
+    }
+    FLUENT_INLINE constexpr T& operator&=(T const& other) noexcept(noexcept(this->underlying().get() &= other.get()))
+    {
+        this->underlying().get() &= other.get();
+        return this->underlying();
+    }
+
+    FLUENT_INLINE constexpr T operator|(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() | other.get())))
+    {
+        return T(this->underlying().get() | other.get());
+    }
+    FLUENT_INLINE constexpr T& operator|=(T const& other) noexcept(noexcept(this->underlying().get() |= other.get()))
+    {
+        this->underlying().get() |= other.get();
+        return this->underlying();
+    }
+
+    FLUENT_INLINE constexpr T operator^(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() ^ other.get())))
+    {
+        return T(this->underlying().get() ^ other.get());
+    }
+    FLUENT_INLINE constexpr T& operator^=(T const& other) noexcept(noexcept(this->underlying().get() ^= other.get()))
+    {
+        this->underlying().get() ^= other.get();
+        return this->underlying();
+    }
+
+    FLUENT_INLINE constexpr T operator<<(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() << other.get())))
+    {
+        return T(this->underlying().get() << other.get());
+    }
+    FLUENT_INLINE constexpr T& operator<<=(T const& other) noexcept(noexcept(this->underlying().get() <<= other.get()))
+    {
+        this->underlying().get() <<= other.get();
+        return this->underlying();
+    }
+
+    FLUENT_INLINE constexpr T operator>>(T const& other) const
+        noexcept(noexcept(T(this->underlying().get() >> other.get())))
+    {
+        return T(this->underlying().get() >> other.get());
+    }
+    FLUENT_INLINE constexpr T& operator>>=(T const& other) noexcept(noexcept(this->underlying().get() >>= other.get()))
+    {
+        this->underlying().get() >>= other.get();
+        return this->underlying();
+    }
+
+    FLUENT_INLINE constexpr bool operator<(T const& other) const
+        noexcept(noexcept(this->underlying().get() < other.get()))
+    {
+        return this->underlying().get() < other.get();
+    }
+    FLUENT_INLINE constexpr bool operator>(T const& other) const
+        noexcept(noexcept(other.get() < this->underlying().get()))
+    {
+        return other.get() < this->underlying().get();
+    }
+    FLUENT_INLINE constexpr bool operator<=(T const& other) const
+        noexcept(noexcept(other.get() < this->underlying().get()))
+    {
+        return !(other.get() < this->underlying().get());
+    }
+    FLUENT_INLINE constexpr bool operator>=(T const& other) const
+        noexcept(noexcept(this->underlying().get() < other.get()))
+    {
+        return !(*this < other);
+    }
+    friend FLUENT_INLINE constexpr bool operator==(Arithmetic<T> const& self, T const& other)
+        noexcept(noexcept(self.underlying().get() < other.get()) && noexcept(other.get() < self.underlying().get()))
+    {
+        return !(self < other) && !(other.get() < self.underlying().get());
+    }
+#if !FLUENT_HAS_THREE_WAY_COMPARISON
+    FLUENT_INLINE constexpr bool operator!=(T const& other) const noexcept(noexcept(*this == other))
+    {
+        return !(*this == other);
+    }
+#endif
+
+    FLUENT_INLINE void print(std::ostream& os) const noexcept(noexcept(os << this->underlying().get()))
+    {
+        os << this->underlying().get();
+    }
 };
 
 } // namespace fluent
@@ -380,13 +927,14 @@ template <typename T, typename Parameter, template <typename> class... Skills>
 struct hash<fluent::NamedType<T, Parameter, Skills...>>
 {
     using NamedType = fluent::NamedType<T, Parameter, Skills...>;
-    using checkIfHashable = typename std::enable_if<NamedType::is_hashable, void>::type;
+    using checkIfHashable = typename std::enable_if<fluent::details::IsHashable<NamedType>::value, void>::type;
+    using Mixer = typename fluent::details::HashMixer<NamedType>::type;
 
-    size_t operator()(fluent::NamedType<T, Parameter, Skills...> const& x) const noexcept
+    FLUENT_INLINE size_t operator()(fluent::NamedType<T, Parameter, Skills...> const& x) const noexcept
     {
-        static_assert(noexcept(std::hash<T>()(x.get())), "hash fuction should not throw");
+        static_assert(noexcept(Mixer()(x.get())), "hash fuction should not throw");
 
-        return std::hash<T>()(x.get());
+        return Mixer()(x.get());
     }
 };
 
@@ -0,0 +1,106 @@
+// The fluent.named_type module: the same library as the headers, parsed once by the compiler instead of once per
+// translation unit. The macros of the headers, such as FLUENT_INLINE, are not part of the module.
+//   import fluent.named_type;
+//   using Meter = fluent::NamedType<double, struct MeterTag, fluent::Arithmetic>;
+
+module;
+
+#include "NamedType/atomic.hpp"
+#include "NamedType/named_type.hpp"
+#include "NamedType/radix_sort.hpp"
+#include "NamedType/sharded.hpp"
+#include "NamedType/slot_map.hpp"
+#include "NamedType/strong_flat_map.hpp"
+#include "NamedType/strong_hash_map.hpp"
+#include "NamedType/strong_span.hpp"
+#include "NamedType/strong_vector.hpp"
+
+export module fluent.named_type;
+
+export namespace fluent
+{
+// atomic.hpp
+using fluent::atomic;
+
+// cache_line.hpp
+using fluent::cache_line_size;
+using fluent::CacheLineAligned;
+
+// named_type_impl.hpp
+using fluent::defaulted;
+using fluent::derived;
+using fluent::is_trivially_relocatable;
+using fluent::make_named;
+using fluent::make_named_arg_function;
+using fluent::NamedType;
+
+// printable.hpp
+using fluent::operator<<;
+using fluent::Printable;
+
+// radix_sort.hpp
+using fluent::radix_sort;
+
+// sharded.hpp
+using fluent::Sharded;
+
+// slot_map.hpp
+using fluent::SlotMap;
+
+// underlying_functionalities.hpp
+using fluent::Addable;
+using fluent::Arithmetic;
+using fluent::AvalancheHashMixer;
+using fluent::BinaryAddable;
+using fluent::BinarySubtractable;
+using fluent::BitWiseAndable;
+using fluent::BitWiseInvertable;
+using fluent::BitWiseLeftShiftable;
+using fluent::BitWiseOrable;
+using fluent::BitWiseRightShiftable;
+using fluent::BitWiseXorable;
+using fluent::Callable;
+using fluent::Comparable;
+using fluent::Divisible;
+using fluent::FunctionCallable;
+using fluent::Hashable;
+using fluent::HashableWith;
+using fluent::ImplicitlyConvertibleTo;
+using fluent::MethodCallable;
+using fluent::MixedHashable;
+using fluent::Modulable;
+using fluent::Multiplicable;
+using fluent::PostDecrementable;
+using fluent::PostIncrementable;
+using fluent::PreDecrementable;
+using fluent::PreIncrementable;
+using fluent::StdHashMixer;
+using fluent::Subtractable;
+using fluent::ThreeWayComparable;
+using fluent::TransparentEqualTo;
+using fluent::TransparentHash;
+using fluent::TransparentLess;
+using fluent::UnaryAddable;
+using fluent::UnarySubtractable;
+
+// strong_flat_map.hpp
+using fluent::sorted_unique;
+using fluent::sorted_unique_t;
+using fluent::StrongFlatMap;
+using fluent::StrongFlatSet;
+
+// strong_hash_map.hpp
+using fluent::StrongHashMap;
+
+// strong_span.hpp
+using fluent::is_layout_compatible_with_underlying;
+#if defined(__cpp_lib_span)
+using fluent::as_raw_span;
+using fluent::as_strong_span;
+#endif
+
+// strong_vector.hpp
+using fluent::strong_iota;
+using fluent::StrongIota;
+using fluent::StrongVector;
+} // namespace fluent
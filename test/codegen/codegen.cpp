@@ -0,0 +1,296 @@
+// Pairs of functions performing the same operation, one on raw types (raw_xxx) and one on strong types (strong_xxx).
+// compare_assembly.cmake checks that each pair compiles to the same instructions, which means that the strong
+// types and their skills have been completely folded away by the compiler.
+// The functions have C linkage so that their symbols don't depend on the mangling of their parameters, and they give
+// their results of class types through an out-parameter, as C functions can't return them.
+
+// The subscripts of StrongVector as in release builds
+#define FLUENT_CHECKED_INDICES 0
+
+#include "NamedType/atomic.hpp"
+#include "NamedType/named_type.hpp"
+#include "NamedType/strong_vector.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using StrongInt = fluent::NamedType<int, struct StrongIntTag, fluent::Arithmetic>;
+using StrongUnsigned = fluent::NamedType<unsigned, struct StrongUnsignedTag, fluent::Arithmetic>;
+using StrongDouble = fluent::NamedType<double, struct StrongDoubleTag, fluent::Arithmetic>;
+using ComparableDouble = fluent::NamedType<double, struct ComparableDoubleTag, fluent::ThreeWayComparable>;
+using StrongCounter = fluent::NamedType<std::int64_t, struct StrongCounterTag, fluent::Addable>;
+using NodeIndex = fluent::NamedType<std::uint32_t, struct NodeIndexTag>;
+
+#define NAMED_TYPE_CODEGEN_BINARY(name, raw, strong, op)                                                               \
+    extern "C" void raw_##name(raw a, raw b, raw* result)                                                              \
+    {                                                                                                                  \
+        *result = a op b;                                                                                              \
+    }                                                                                                                  \
+    extern "C" void strong_##name(strong a, strong b, strong* result)                                                  \
+    {                                                                                                                  \
+        *result = a op b;                                                                                              \
+    }
+
+#define NAMED_TYPE_CODEGEN_COMPOUND(name, raw, strong, op)                                                             \
+    extern "C" void raw_##name(raw* a, raw const* b)                                                                   \
+    {                                                                                                                  \
+        *a op##= *b;                                                                                                   \
+    }                                                                                                                  \
+    extern "C" void strong_##name(strong* a, strong const* b)                                                          \
+    {                                                                                                                  \
+        *a op##= *b;                                                                                                   \
+    }
+
+#define NAMED_TYPE_CODEGEN_UNARY(name, raw, strong, op)                                                                \
+    extern "C" void raw_##name(raw a, raw* result)                                                                     \
+    {                                                                                                                  \
+        *result = op a;                                                                                                \
+    }                                                                                                                  \
+    extern "C" void strong_##name(strong a, strong* result)                                                            \
+    {                                                                                                                  \
+        *result = op a;                                                                                                \
+    }
+
+#define NAMED_TYPE_CODEGEN_COMPARISON(name, raw, strong, op)                                                           \
+    extern "C" bool raw_##name(raw a, raw b)                                                                           \
+    {                                                                                                                  \
+        return a op b;                                                                                                 \
+    }                                                                                                                  \
+    extern "C" bool strong_##name(strong a, strong b)                                                                  \
+    {                                                                                                                  \
+        return a op b;                                                                                                 \
+    }
+
+// Addable, Subtractable, Multiplicable, Divisible, Modulable
+
+NAMED_TYPE_CODEGEN_BINARY(add_int, int, StrongInt, +)
+NAMED_TYPE_CODEGEN_BINARY(subtract_int, int, StrongInt, -)
+NAMED_TYPE_CODEGEN_BINARY(multiply_int, int, StrongInt, *)
+NAMED_TYPE_CODEGEN_BINARY(divide_int, int, StrongInt, /)
+NAMED_TYPE_CODEGEN_BINARY(modulo_int, int, StrongInt, %)
+NAMED_TYPE_CODEGEN_UNARY(plus_int, int, StrongInt, +)
+NAMED_TYPE_CODEGEN_UNARY(negate_int, int, StrongInt, -)
+NAMED_TYPE_CODEGEN_COMPOUND(add_assign_int, int, StrongInt, +)
+NAMED_TYPE_CODEGEN_COMPOUND(subtract_assign_int, int, StrongInt, -)
+NAMED_TYPE_CODEGEN_COMPOUND(multiply_assign_int, int, StrongInt, *)
+NAMED_TYPE_CODEGEN_COMPOUND(divide_assign_int, int, StrongInt, /)
+NAMED_TYPE_CODEGEN_COMPOUND(modulo_assign_int, int, StrongInt, %)
+
+NAMED_TYPE_CODEGEN_BINARY(add_double, double, StrongDouble, +)
+NAMED_TYPE_CODEGEN_BINARY(subtract_double, double, StrongDouble, -)
+NAMED_TYPE_CODEGEN_BINARY(multiply_double, double, StrongDouble, *)
+NAMED_TYPE_CODEGEN_BINARY(divide_double, double, StrongDouble, /)
+NAMED_TYPE_CODEGEN_UNARY(negate_double, double, StrongDouble, -)
+NAMED_TYPE_CODEGEN_COMPOUND(add_assign_double, double, StrongDouble, +)
+NAMED_TYPE_CODEGEN_COMPOUND(multiply_assign_double, double, StrongDouble, *)
+
+// PreIncrementable, PostIncrementable, PreDecrementable, PostDecrementable
+
+extern "C" void raw_increment_int(int* a)
+{
+    ++*a;
+}
+extern "C" void strong_increment_int(StrongInt* a)
+{
+    ++*a;
+}
+
+extern "C" void raw_post_increment_int(int* a, int* result)
+{
+    *result = (*a)++;
+}
+extern "C" void strong_post_increment_int(StrongInt* a, StrongInt* result)
+{
+    *result = (*a)++;
+}
+
+extern "C" void raw_decrement_int(int* a)
+{
+    --*a;
+}
+extern "C" void strong_decrement_int(StrongInt* a)
+{
+    --*a;
+}
+
+extern "C" void raw_post_decrement_int(int* a, int* result)
+{
+    *result = (*a)--;
+}
+extern "C" void strong_post_decrement_int(StrongInt* a, StrongInt* result)
+{
+    *result = (*a)--;
+}
+
+// BitWise skills
+
+NAMED_TYPE_CODEGEN_UNARY(invert_unsigned, unsigned, StrongUnsigned, ~)
+NAMED_TYPE_CODEGEN_BINARY(and_unsigned, unsigned, StrongUnsigned, &)
+NAMED_TYPE_CODEGEN_BINARY(or_unsigned, unsigned, StrongUnsigned, |)
+NAMED_TYPE_CODEGEN_BINARY(xor_unsigned, unsigned, StrongUnsigned, ^)
+NAMED_TYPE_CODEGEN_BINARY(left_shift_unsigned, unsigned, StrongUnsigned, <<)
+NAMED_TYPE_CODEGEN_BINARY(right_shift_unsigned, unsigned, StrongUnsigned, >>)
+NAMED_TYPE_CODEGEN_COMPOUND(xor_assign_unsigned, unsigned, StrongUnsigned, ^)
+NAMED_TYPE_CODEGEN_COMPOUND(left_shift_assign_unsigned, unsigned, StrongUnsigned, <<)
+
+// Comparable
+
+NAMED_TYPE_CODEGEN_COMPARISON(less_int, int, StrongInt, <)
+NAMED_TYPE_CODEGEN_COMPARISON(greater_equal_int, int, StrongInt, >=)
+NAMED_TYPE_CODEGEN_COMPARISON(equal_int, int, StrongInt, ==)
+NAMED_TYPE_CODEGEN_COMPARISON(not_equal_int, int, StrongInt, !=)
+NAMED_TYPE_CODEGEN_COMPARISON(less_double, double, StrongDouble, <)
+
+// Comparable only requires operator< on the underlying type, so a > b is computed as b < a
+extern "C" bool raw_greater_int(int a, int b)
+{
+    return b < a;
+}
+extern "C" bool strong_greater_int(StrongInt a, StrongInt b)
+{
+    return a > b;
+}
+
+extern "C" bool raw_less_equal_int(int a, int b)
+{
+    return !(b < a);
+}
+extern "C" bool strong_less_equal_int(StrongInt a, StrongInt b)
+{
+    return a <= b;
+}
+
+extern "C" bool raw_greater_double(double a, double b)
+{
+    return b < a;
+}
+extern "C" bool strong_greater_double(StrongDouble a, StrongDouble b)
+{
+    return a > b;
+}
+
+// ThreeWayComparable
+
+NAMED_TYPE_CODEGEN_COMPARISON(three_way_equal_double, double, ComparableDouble, ==)
+NAMED_TYPE_CODEGEN_COMPARISON(three_way_not_equal_double, double, ComparableDouble, !=)
+NAMED_TYPE_CODEGEN_COMPARISON(three_way_less_double, double, ComparableDouble, <)
+NAMED_TYPE_CODEGEN_COMPARISON(three_way_greater_equal_double, double, ComparableDouble, >=)
+
+// Loops, where the strong types must not prevent vectorization
+
+extern "C" void raw_sum_int(int const* values, std::size_t size, int* result)
+{
+    int sum = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        sum += values[i];
+    }
+    *result = sum;
+}
+extern "C" void strong_sum_int(StrongInt const* values, std::size_t size, StrongInt* result)
+{
+    StrongInt sum{0};
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        sum += values[i];
+    }
+    *result = sum;
+}
+
+extern "C" void raw_scale_double(double* values, std::size_t size, double factor)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        values[i] *= factor;
+    }
+}
+extern "C" void strong_scale_double(StrongDouble* values, std::size_t size, StrongDouble factor)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        values[i] *= factor;
+    }
+}
+
+extern "C" std::size_t raw_count_less_int(int const* values, std::size_t size, int threshold)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        count += values[i] < threshold ? 1 : 0;
+    }
+    return count;
+}
+extern "C" std::size_t strong_count_less_int(StrongInt const* values, std::size_t size, StrongInt threshold)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        count += values[i] < threshold ? 1 : 0;
+    }
+    return count;
+}
+
+// fluent::atomic
+
+extern "C" void raw_atomic_load(std::atomic<std::int64_t> const* counter, std::int64_t* result)
+{
+    *result = counter->load(std::memory_order_acquire);
+}
+extern "C" void strong_atomic_load(fluent::atomic<StrongCounter> const* counter, StrongCounter* result)
+{
+    *result = counter->load(std::memory_order_acquire);
+}
+
+extern "C" void raw_atomic_fetch_add(std::atomic<std::int64_t>* counter, std::int64_t increment, std::int64_t* result)
+{
+    *result = counter->fetch_add(increment, std::memory_order_relaxed);
+}
+extern "C" void
+strong_atomic_fetch_add(fluent::atomic<StrongCounter>* counter, StrongCounter increment, StrongCounter* result)
+{
+    *result = counter->fetch_add(increment, std::memory_order_relaxed);
+}
+
+extern "C" bool
+raw_atomic_compare_exchange(std::atomic<std::int64_t>* counter, std::int64_t* expected, std::int64_t desired)
+{
+    return counter->compare_exchange_strong(*expected, desired);
+}
+extern "C" bool
+strong_atomic_compare_exchange(fluent::atomic<StrongCounter>* counter, StrongCounter* expected, StrongCounter desired)
+{
+    return counter->compare_exchange_strong(*expected, desired);
+}
+
+// StrongVector
+
+extern "C" double raw_vector_subscript(std::vector<double> const* values, std::uint32_t index)
+{
+    return (*values)[index];
+}
+extern "C" double strong_vector_subscript(fluent::StrongVector<NodeIndex, double> const* values, NodeIndex index)
+{
+    return (*values)[index];
+}
+
+extern "C" double raw_vector_sum(std::vector<double> const* values)
+{
+    double sum = 0;
+    for (std::uint32_t index = 0; index < static_cast<std::uint32_t>(values->size()); ++index)
+    {
+        sum += (*values)[index];
+    }
+    return sum;
+}
+extern "C" double strong_vector_sum(fluent::StrongVector<NodeIndex, double> const* values)
+{
+    double sum = 0;
+    for (NodeIndex index : values->indices())
+    {
+        sum += (*values)[index];
+    }
+    return sum;
+}
@@ -0,0 +1,67 @@
+# Disassembles OBJECTS with OBJDUMP and checks that every function strong_xxx has the same instructions
+# as its counterpart raw_xxx.
+
+if (NOT OBJDUMP OR NOT OBJECTS)
+	message(FATAL_ERROR "Usage: cmake -DOBJDUMP=<objdump> -DOBJECTS=<object files> -P compare_assembly.cmake")
+endif()
+
+execute_process(
+	COMMAND "${OBJDUMP}" --disassemble --no-show-raw-insn ${OBJECTS}
+	OUTPUT_VARIABLE disassembly
+	RESULT_VARIABLE result
+)
+if (NOT result EQUAL 0)
+	message(FATAL_ERROR "${OBJDUMP} failed on ${OBJECTS}")
+endif()
+
+# Semicolons and square brackets would be interpreted by the list manipulations below
+string(REPLACE ";" "<semicolon>" disassembly "${disassembly}")
+string(REPLACE "[" "<open>" disassembly "${disassembly}")
+string(REPLACE "]" "<close>" disassembly "${disassembly}")
+string(REPLACE "\n" ";" lines "${disassembly}")
+
+set(functions "")
+set(function "")
+foreach(line IN LISTS lines)
+	if (line MATCHES "^[0-9a-f]+ <([A-Za-z0-9_]+)>:$")
+		set(function "${CMAKE_MATCH_1}")
+		list(APPEND functions "${function}")
+		set("instructions_${function}" "")
+	elseif (function AND line MATCHES "^ *[0-9a-f]+:[ \t]+(.+)$")
+		set(instruction "${CMAKE_MATCH_1}")
+		# Absolute addresses and symbol names differ between the two functions, offsets within them don't
+		string(REGEX REPLACE "[0-9a-f]+ <[A-Za-z0-9_.]+(\\+0x[0-9a-f]+)?>" "\\1" instruction "${instruction}")
+		string(REGEX REPLACE "[ \t]*#.*$" "" instruction "${instruction}")
+		string(REGEX REPLACE "[ \t]+" " " instruction "${instruction}")
+		string(APPEND "instructions_${function}" "    ${instruction}\n")
+	endif()
+endforeach()
+
+set(comparisons 0)
+set(differences "")
+foreach(function IN LISTS functions)
+	if (function MATCHES "^strong_(.+)$")
+		set(raw "raw_${CMAKE_MATCH_1}")
+		if (NOT DEFINED "instructions_${raw}")
+			string(APPEND differences "${function} has no counterpart ${raw}\n")
+		elseif (NOT "${instructions_${function}}" STREQUAL "${instructions_${raw}}")
+			string(APPEND differences "${function} differs from ${raw}:\n")
+			string(APPEND differences "  ${function}:\n${instructions_${function}}")
+			string(APPEND differences "  ${raw}:\n${instructions_${raw}}")
+		endif()
+		math(EXPR comparisons "${comparisons} + 1")
+	endif()
+endforeach()
+
+if (comparisons EQUAL 0)
+	message(FATAL_ERROR "No strong_xxx function found in ${OBJECTS}")
+endif()
+
+if (differences)
+	string(REPLACE "<semicolon>" ";" differences "${differences}")
+	string(REPLACE "<open>" "[" differences "${differences}")
+	string(REPLACE "<close>" "]" differences "${differences}")
+	message(FATAL_ERROR "Strong types generate different code than raw types:\n${differences}")
+endif()
+
+message(STATUS "${comparisons} strong functions compile to the same code as their raw counterparts")
@@ -8,13 +8,31 @@
 
 #include "catch.hpp"
 
+#include "NamedType/atomic.hpp"
 #include "NamedType/named_type.hpp"
-
+#include "NamedType/radix_sort.hpp"
+#include "NamedType/sharded.hpp"
+#include "NamedType/slot_map.hpp"
+#include "NamedType/strong_flat_map.hpp"
+#include "NamedType/strong_hash_map.hpp"
+#include "NamedType/strong_span.hpp"
+#include "NamedType/strong_vector.hpp"
+
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -293,7 +311,7 @@ TEST_CASE("ConvertibleWithOperator")
         A(int x_) : x(x_)
         {
         }
-        operator B() const
+        operator B() const noexcept
         {
             return B(x);
         }
@@ -318,7 +336,7 @@ TEST_CASE("ConvertibleWithConstructor")
 
     struct B
     {
-        B(A a) : x(a.x)
+        B(A a) noexcept : x(a.x)
         {
         }
         int x;
@@ -488,6 +506,53 @@ TEST_CASE("Named arguments in any order")
     REQUIRE(otherFullName == "JamesBond");
 }
 
+using Host = fluent::NamedType<std::string, struct HostTag>;
+using Port = fluent::NamedType<int, struct PortTag>;
+
+Host const localhost("localhost");
+
+struct DefaultHost
+{
+    Host const& operator()() const noexcept
+    {
+        return localhost;
+    }
+};
+
+TEST_CASE("Named arguments with default values")
+{
+    static const Host::argument host;
+    static const Port::argument port;
+
+    auto address = fluent::make_named_arg_function<fluent::defaulted<Host, DefaultHost>,
+                                                   fluent::defaulted<Port, std::integral_constant<int, 80>>>(
+        [](Host const& host_, Port const& port_) { return host_.get() + ":" + std::to_string(port_.get()); });
+
+    CHECK(address(host = "example.com", port = 8080) == "example.com:8080");
+    CHECK(address(port = 8080, host = "example.com") == "example.com:8080");
+    CHECK(address(host = "example.com") == "example.com:80");
+    CHECK(address(port = 8080) == "localhost:8080");
+    CHECK(address() == "localhost:80");
+}
+
+TEST_CASE("Named arguments with default values mixed with required ones")
+{
+    using FirstName = fluent::NamedType<std::string, struct FirstNameTag>;
+    static const FirstName::argument firstName;
+
+    auto greet = fluent::make_named_arg_function<fluent::defaulted<Host, DefaultHost>, FirstName>(
+        [](Host const& host_, FirstName const& firstName_) { return firstName_.get() + "@" + host_.get(); });
+    CHECK(greet(firstName = "James") == "James@localhost");
+    CHECK(greet(Host("mi6"), firstName = "James") == "James@mi6");
+}
+
+TEST_CASE("Omitted named arguments are not constructed")
+{
+    auto defaultHostAddress = fluent::make_named_arg_function<fluent::defaulted<Host, DefaultHost>>(
+        [](Host const& host_) { return &host_; });
+    CHECK(defaultHostAddress() == &localhost);
+}
+
 TEST_CASE("Named arguments with bracket constructor")
 {
     using Numbers = fluent::NamedType<std::vector<int>, struct NumbersTag>;
@@ -566,3 +631,1282 @@ TEST_CASE("Arithmetic")
     a /= b;
     CHECK(a.get() == 5);
 }
+
+TEST_CASE("Arithmetic has the operators of all its skills")
+{
+    using strong_arithmetic = fluent::NamedType<int, struct ArithmeticTag, fluent::Arithmetic>;
+    strong_arithmetic a{6};
+    strong_arithmetic const b{3};
+
+    CHECK((++a).get() == 7);
+    CHECK((a++).get() == 7);
+    CHECK((--a).get() == 7);
+    CHECK((a--).get() == 7);
+    CHECK(a.get() == 6);
+    CHECK((+a).get() == 6);
+    CHECK((-a).get() == -6);
+    CHECK((a % b).get() == 0);
+    a %= strong_arithmetic{4};
+    CHECK(a.get() == 2);
+
+    CHECK((~a).get() == ~2);
+    CHECK((a & b).get() == 2);
+    CHECK((a | b).get() == 3);
+    CHECK((a ^ b).get() == 1);
+    CHECK((a << b).get() == 16);
+    CHECK((strong_arithmetic{16} >> b).get() == 2);
+    a |= b;
+    a &= strong_arithmetic{6};
+    a ^= strong_arithmetic{1};
+    a <<= b;
+    a >>= strong_arithmetic{1};
+    CHECK(a.get() == 12);
+
+    CHECK(b < a);
+    CHECK(a > b);
+    CHECK(b <= a);
+    CHECK(a >= b);
+    CHECK(a == strong_arithmetic{12});
+    CHECK(a != b);
+
+    std::ostringstream os;
+    os << a;
+    CHECK(os.str() == "12");
+    CHECK(std::hash<strong_arithmetic>()(a) == std::hash<int>()(12));
+}
+
+struct throw_on_operation
+{
+    explicit throw_on_operation(int value_) : value(value_)
+    {
+    }
+    throw_on_operation& operator++()
+    {
+        if (value == 0)
+        {
+            throw "exception";
+        }
+        ++value;
+        return *this;
+    }
+    throw_on_operation& operator+=(throw_on_operation const& other)
+    {
+        if (other.value == 0)
+        {
+            throw "exception";
+        }
+        value += other.value;
+        return *this;
+    }
+    int value;
+};
+
+throw_on_operation operator+(throw_on_operation const& lhs, throw_on_operation const& rhs)
+{
+    if (rhs.value == 0)
+    {
+        throw "exception";
+    }
+    return throw_on_operation(lhs.value + rhs.value);
+}
+
+bool operator<(throw_on_operation const& lhs, throw_on_operation const& rhs)
+{
+    if (rhs.value == 0)
+    {
+        throw "exception";
+    }
+    return lhs.value < rhs.value;
+}
+
+// Converts implicitly from long only, and explicitly from int without throwing
+struct ConvertedFromLong
+{
+    explicit ConvertedFromLong(int) noexcept
+    {
+    }
+    ConvertedFromLong(long value)
+    {
+        if (value < 0)
+        {
+            throw "exception";
+        }
+    }
+};
+
+TEST_CASE("noexcept skills")
+{
+    using strong_arithmetic = fluent::NamedType<int, struct ArithmeticTag, fluent::Arithmetic>;
+    strong_arithmetic a{1};
+    strong_arithmetic const b{2};
+
+    static_assert(noexcept(++a), "PreIncrementable is not noexcept");
+    static_assert(noexcept(a++), "PostIncrementable is not noexcept");
+    static_assert(noexcept(--a), "PreDecrementable is not noexcept");
+    static_assert(noexcept(a--), "PostDecrementable is not noexcept");
+    static_assert(noexcept(a + b) && noexcept(a += b) && noexcept(+a), "Addable is not noexcept");
+    static_assert(noexcept(a - b) && noexcept(a -= b) && noexcept(-a), "Subtractable is not noexcept");
+    static_assert(noexcept(a * b) && noexcept(a *= b), "Multiplicable is not noexcept");
+    static_assert(noexcept(a / b) && noexcept(a /= b), "Divisible is not noexcept");
+    static_assert(noexcept(a % b) && noexcept(a %= b), "Modulable is not noexcept");
+    static_assert(noexcept(~a), "BitWiseInvertable is not noexcept");
+    static_assert(noexcept(a & b) && noexcept(a &= b), "BitWiseAndable is not noexcept");
+    static_assert(noexcept(a | b) && noexcept(a |= b), "BitWiseOrable is not noexcept");
+    static_assert(noexcept(a ^ b) && noexcept(a ^= b), "BitWiseXorable is not noexcept");
+    static_assert(noexcept(a << b) && noexcept(a <<= b), "BitWiseLeftShiftable is not noexcept");
+    static_assert(noexcept(a >> b) && noexcept(a >>= b), "BitWiseRightShiftable is not noexcept");
+    static_assert(
+        noexcept(a < b) && noexcept(a > b) && noexcept(a <= b) && noexcept(a >= b) && noexcept(a == b) &&
+            noexcept(a != b),
+        "Comparable is not noexcept");
+    static_assert(noexcept(std::hash<strong_arithmetic>()(a)), "Hashable is not noexcept");
+
+    using ConvertibleInt = fluent::NamedType<int, struct ConvertibleIntTag, fluent::ImplicitlyConvertibleTo<long>::templ>;
+    static_assert(noexcept(static_cast<long>(ConvertibleInt(42))), "ImplicitlyConvertibleTo is not noexcept");
+    using ThrowingConvertibleInt = fluent::NamedType<int, struct ThrowingConvertibleIntTag,
+                                                     fluent::ImplicitlyConvertibleTo<ConvertedFromLong>::templ>;
+    static_assert(!noexcept(std::declval<ThrowingConvertibleInt const&>().operator ConvertedFromLong()),
+                  "ImplicitlyConvertibleTo is noexcept although the implicit conversion may throw");
+
+    using CallableString = fluent::NamedType<std::string, struct CallableStringTag, fluent::Callable>;
+    CallableString s{"string"};
+    static_assert(noexcept(static_cast<std::string const&>(s)), "FunctionCallable is not noexcept");
+    static_assert(noexcept(s->size()), "MethodCallable is not noexcept");
+
+    using throwing_strong = fluent::NamedType<
+        throw_on_operation,
+        struct ThrowingTag,
+        fluent::PreIncrementable,
+        fluent::BinaryAddable,
+        fluent::Comparable>;
+    throwing_strong t{throw_on_operation(1)};
+
+    static_assert(!noexcept(++t), "PreIncrementable is noexcept with a throwing operator++");
+    static_assert(!noexcept(t + t), "BinaryAddable is noexcept with a throwing operator+");
+    static_assert(!noexcept(t += t), "BinaryAddable is noexcept with a throwing operator+=");
+    static_assert(!noexcept(t < t), "Comparable is noexcept with a throwing operator<");
+    static_assert(!noexcept(t == t), "Comparable is noexcept with a throwing operator<");
+}
+
+TEST_CASE("ThreeWayComparable")
+{
+    using Identifier = fluent::NamedType<std::string, struct IdentifierTag, fluent::ThreeWayComparable>;
+    Identifier const a{"a"};
+    Identifier const b{"b"};
+
+    CHECK((a == Identifier{"a"}));
+    CHECK((!(a == b)));
+    CHECK((a != b));
+    CHECK((!(a != Identifier{"a"})));
+    CHECK((a < b));
+    CHECK((!(b < a)));
+    CHECK((b > a));
+    CHECK((!(a > b)));
+    CHECK((a <= b));
+    CHECK((a <= Identifier{"a"}));
+    CHECK((b >= a));
+    CHECK((b >= Identifier{"b"}));
+    CHECK((!(b <= a)));
+
+    using Length = fluent::NamedType<double, struct LengthTag, fluent::ThreeWayComparable>;
+    Length const nan{std::nan("")};
+    CHECK((!(nan == nan)));
+    CHECK((nan != nan));
+    CHECK((Length{-0.} == Length{0.}));
+
+#if FLUENT_HAS_THREE_WAY_COMPARISON
+    CHECK((a <=> b) == std::strong_ordering::less);
+    CHECK((nan <=> nan) == std::partial_ordering::unordered);
+#endif
+}
+
+struct ModuloHashMixer
+{
+    std::size_t operator()(int value) const noexcept
+    {
+        return static_cast<std::size_t>(value % 10);
+    }
+};
+
+TEST_CASE("MixedHashable")
+{
+    using Id = fluent::NamedType<int, struct IdTag, fluent::MixedHashable, fluent::Comparable>;
+
+    std::unordered_map<Id, int> hashMap;
+    for (int i = 0; i < 100; ++i)
+    {
+        hashMap[Id{i}] = i * 2;
+    }
+    REQUIRE(hashMap.size() == 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(hashMap[Id{i}] == i * 2);
+    }
+
+    // Consecutive identifiers differ in the low bits of their hashes
+    CHECK(std::hash<Id>()(Id{1}) == std::hash<Id>()(Id{1}));
+    CHECK(std::hash<Id>()(Id{1}) != std::hash<Id>()(Id{2}));
+    CHECK((std::hash<Id>()(Id{0x100}) & 0xff) != (std::hash<Id>()(Id{0x200}) & 0xff));
+
+    using SerialNumber = fluent::NamedType<std::string, struct SerialNumberTag, fluent::MixedHashable>;
+    CHECK(std::hash<SerialNumber>()(SerialNumber{"AA11"}) == std::hash<SerialNumber>()(SerialNumber{"AA11"}));
+    CHECK(std::hash<SerialNumber>()(SerialNumber{"AA11"}) != std::hash<SerialNumber>()(SerialNumber{"BB22"}));
+
+    using ArithmeticId = fluent::NamedType<int, struct ArithmeticIdTag, fluent::Arithmetic, fluent::MixedHashable>;
+    CHECK(std::hash<ArithmeticId>()(ArithmeticId{42}) == std::hash<Id>()(Id{42}));
+
+    using ModuloId = fluent::NamedType<int, struct ModuloIdTag, fluent::HashableWith<ModuloHashMixer>::templ>;
+    CHECK(std::hash<ModuloId>()(ModuloId{42}) == 2);
+
+    // Hashing a strong type with two hash mixers doesn't compile, instead of using std::hash
+    static_assert(fluent::details::HashMixerCount<ModuloId>::value == 1, "");
+    using TwoMixersId = fluent::NamedType<int, struct TwoMixersIdTag, fluent::MixedHashable,
+                                          fluent::HashableWith<ModuloHashMixer>::templ>;
+    static_assert(fluent::details::HashMixerCount<TwoMixersId>::value == 2, "");
+}
+
+TEST_CASE("Transparent lookup with a strong type of the same tag")
+{
+    using Name = fluent::NamedType<std::string, struct NameTag, fluent::Hashable>;
+    using NameView = fluent::NamedType<std::string_view, struct NameTag>;
+    using OtherNameView = fluent::NamedType<std::string_view, struct OtherNameTag>;
+
+    std::map<Name, int, fluent::TransparentLess<Name>> orderedMap = {{Name{"AA11"}, 10}, {Name{"BB22"}, 20}};
+    REQUIRE(orderedMap.find(NameView{"AA11"}) != orderedMap.end());
+    CHECK(orderedMap.find(NameView{"AA11"})->second == 10);
+    CHECK(orderedMap.find(NameView{"BB22"})->second == 20);
+    CHECK(orderedMap.find(NameView{"CC33"}) == orderedMap.end());
+    CHECK(orderedMap.find(Name{"BB22"})->second == 20);
+
+    using TransparentHash = fluent::TransparentHash<Name>;
+    CHECK(TransparentHash()(NameView{"AA11"}) == std::hash<Name>()(Name{"AA11"}));
+    CHECK(fluent::TransparentEqualTo<Name>()(Name{"AA11"}, NameView{"AA11"}));
+    CHECK(!fluent::TransparentEqualTo<Name>()(NameView{"BB22"}, Name{"AA11"}));
+    using Ratio = fluent::NamedType<double, struct TransparentRatioTag>;
+    CHECK(fluent::TransparentEqualTo<Ratio>()(Ratio{0.5}, Ratio{0.5}));
+
+    using MixedName = fluent::NamedType<std::string, struct NameTag, fluent::MixedHashable>;
+    CHECK(fluent::TransparentHash<MixedName>()(NameView{"AA11"}) == std::hash<MixedName>()(MixedName{"AA11"}));
+
+    // Only strong types of the same tag can be used to look up
+    static_assert(
+        !std::is_invocable<fluent::TransparentLess<Name>, Name const&, OtherNameView const&>::value,
+        "TransparentLess compares strong types of different tags");
+    static_assert(
+        !std::is_invocable<TransparentHash, OtherNameView const&>::value,
+        "TransparentHash hashes strong types of different tags");
+
+#if defined(__cpp_lib_generic_unordered_lookup)
+    std::unordered_map<Name, int, TransparentHash, fluent::TransparentEqualTo<Name>> hashMap = {
+        {Name{"AA11"}, 10}, {Name{"BB22"}, 20}};
+    REQUIRE(hashMap.find(NameView{"AA11"}) != hashMap.end());
+    CHECK(hashMap.find(NameView{"AA11"})->second == 10);
+    CHECK(hashMap.find(NameView{"BB22"})->second == 20);
+    CHECK(hashMap.find(NameView{"CC33"}) == hashMap.end());
+#endif
+}
+
+TEST_CASE("Layout compatibility with the underlying type")
+{
+    using UserId = fluent::NamedType<std::uint64_t, struct UserIdTag, fluent::Arithmetic, fluent::MixedHashable>;
+    using Ratio = fluent::NamedType<double, struct RatioTag, fluent::Addable, fluent::Comparable, fluent::Callable>;
+    static_assert(fluent::is_layout_compatible_with_underlying<UserId>::value, "UserId doesn't have a raw layout");
+    static_assert(fluent::is_layout_compatible_with_underlying<UserId const>::value, "UserId const isn't compatible");
+    static_assert(fluent::is_layout_compatible_with_underlying<Ratio>::value, "Ratio doesn't have a raw layout");
+    static_assert(fluent::is_layout_compatible_with_underlying<Meter>::value, "Meter doesn't have a raw layout");
+    static_assert(!fluent::is_layout_compatible_with_underlying<NameRef>::value, "A strong reference has a layout");
+    static_assert(!fluent::is_layout_compatible_with_underlying<std::uint64_t>::value, "A raw type is compatible");
+    using Name = fluent::NamedType<std::string, struct LayoutNameTag>;
+    static_assert(!fluent::is_layout_compatible_with_underlying<Name>::value, "A string can be created from bytes");
+
+#if defined(__cpp_lib_span)
+    std::vector<std::uint64_t> rawIds = {1, 2, 3};
+    std::span<UserId> userIds = fluent::as_strong_span<UserId>(rawIds);
+    REQUIRE(userIds.size() == 3);
+    CHECK(userIds[1].get() == 2);
+    userIds[2] += UserId{40};
+    CHECK(rawIds[2] == 43);
+
+    std::vector<double> const rawRatios = {0.5, 1.5};
+    std::span<Ratio const> ratios = fluent::as_strong_span<Ratio>(std::span(rawRatios));
+    REQUIRE(ratios.size() == 2);
+    CHECK((ratios[0] < ratios[1]));
+
+    std::span<std::uint64_t> backToRaw = fluent::as_raw_span(userIds);
+    CHECK(backToRaw.data() == rawIds.data());
+    CHECK(backToRaw.size() == 3);
+
+    std::vector<UserId> const strongIds = {UserId{7}, UserId{8}};
+    std::span<std::uint64_t const> rawView = fluent::as_raw_span(strongIds);
+    REQUIRE(rawView.size() == 2);
+    CHECK(rawView[1] == 8);
+
+    std::array<std::uint64_t, 2> fixed = {4, 5};
+    std::span<UserId, 2> fixedIds = fluent::as_strong_span<UserId>(std::span(fixed));
+    CHECK(fixedIds[0].get() == 4);
+#endif
+}
+
+template <template <typename> class... Skills>
+constexpr bool isTriviallyCopyableWith()
+{
+    using Strong = fluent::NamedType<int, struct TriviallyCopyableTag, Skills...>;
+    return std::is_trivially_copyable<Strong>::value && std::is_trivially_destructible<Strong>::value &&
+           fluent::is_trivially_relocatable<Strong>::value;
+}
+
+struct relocatable_handle
+{
+    relocatable_handle() = default;
+    relocatable_handle(relocatable_handle const&)
+    {
+    }
+    int* resource = nullptr;
+};
+
+namespace fluent
+{
+template <>
+struct is_trivially_relocatable<relocatable_handle> : std::true_type
+{
+};
+} // namespace fluent
+
+// A skill that holds a std::string, and that can't be relocated by copying its bytes
+template <typename T>
+struct StatefulSkill : fluent::crtp<T, StatefulSkill>
+{
+    std::string history;
+};
+
+TEST_CASE("Trivially copyable and relocatable")
+{
+    static_assert(isTriviallyCopyableWith<>(), "NamedType is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::PreIncrementable>(), "PreIncrementable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::PostIncrementable>(), "PostIncrementable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::PreDecrementable>(), "PreDecrementable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::PostDecrementable>(), "PostDecrementable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::BinaryAddable>(), "BinaryAddable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::UnaryAddable>(), "UnaryAddable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::Addable>(), "Addable is not trivially copyable");
+    static_assert(
+        isTriviallyCopyableWith<fluent::BinarySubtractable>(), "BinarySubtractable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::UnarySubtractable>(), "UnarySubtractable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::Subtractable>(), "Subtractable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::Multiplicable>(), "Multiplicable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::Divisible>(), "Divisible is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::Modulable>(), "Modulable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::BitWiseInvertable>(), "BitWiseInvertable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::BitWiseAndable>(), "BitWiseAndable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::BitWiseOrable>(), "BitWiseOrable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::BitWiseXorable>(), "BitWiseXorable is not trivially copyable");
+    static_assert(
+        isTriviallyCopyableWith<fluent::BitWiseLeftShiftable>(), "BitWiseLeftShiftable is not trivially copyable");
+    static_assert(
+        isTriviallyCopyableWith<fluent::BitWiseRightShiftable>(), "BitWiseRightShiftable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::Comparable>(), "Comparable is not trivially copyable");
+    static_assert(
+        isTriviallyCopyableWith<fluent::ThreeWayComparable>(), "ThreeWayComparable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::Printable>(), "Printable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::Hashable>(), "Hashable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::MixedHashable>(), "MixedHashable is not trivially copyable");
+    static_assert(
+        isTriviallyCopyableWith<fluent::ImplicitlyConvertibleTo<long>::templ>(),
+        "ImplicitlyConvertibleTo is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::FunctionCallable>(), "FunctionCallable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::MethodCallable>(), "MethodCallable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::Callable>(), "Callable is not trivially copyable");
+    static_assert(isTriviallyCopyableWith<fluent::Arithmetic>(), "Arithmetic is not trivially copyable");
+    static_assert(
+        isTriviallyCopyableWith<fluent::Arithmetic, fluent::Callable, fluent::ImplicitlyConvertibleTo<long>::templ>(),
+        "A combination of skills is not trivially copyable");
+
+    using StrongString = fluent::NamedType<std::string, struct StrongStringTag, fluent::Comparable>;
+    static_assert(!std::is_trivially_copyable<StrongString>::value, "A strong std::string is trivially copyable");
+    static_assert(!fluent::is_trivially_relocatable<StrongString>::value, "A strong string is trivially relocatable");
+
+    using StrongHandle = fluent::NamedType<relocatable_handle, struct StrongHandleTag, fluent::MethodCallable>;
+    static_assert(!std::is_trivially_copyable<StrongHandle>::value, "A strong handle is trivially copyable");
+    static_assert(fluent::is_trivially_relocatable<StrongHandle>::value, "A strong handle isn't trivially relocatable");
+
+    static_assert(!fluent::is_trivially_relocatable<NameRef>::value, "A strong reference is trivially relocatable");
+
+    using StatefulInt = fluent::NamedType<int, struct StatefulIntTag, fluent::Comparable, StatefulSkill>;
+    static_assert(!fluent::is_trivially_relocatable<StatefulInt>::value, "A stateful skill is trivially relocatable");
+}
+
+struct copy_move_counter
+{
+    copy_move_counter(int value_ = 0) : value(value_)
+    {
+    }
+    copy_move_counter(int value_, int factor) : value(value_ * factor)
+    {
+    }
+    copy_move_counter(copy_move_counter const& other) : value(other.value)
+    {
+        ++copies;
+    }
+    copy_move_counter(copy_move_counter&& other) noexcept : value(other.value)
+    {
+        ++moves;
+    }
+    copy_move_counter& operator=(copy_move_counter const&) = delete;
+    copy_move_counter& operator=(copy_move_counter&&) = delete;
+
+    static void reset()
+    {
+        copies = 0;
+        moves = 0;
+    }
+
+    int value;
+    static int copies;
+    static int moves;
+};
+
+int copy_move_counter::copies = 0;
+int copy_move_counter::moves = 0;
+
+template <typename T>
+using Counted = fluent::NamedType<T, struct CountedTag>;
+
+TEST_CASE("In place construction")
+{
+    using StrongVector = fluent::NamedType<std::vector<int>, struct StrongVectorTag>;
+    StrongVector const numbers(std::in_place, 3, 42);
+    CHECK(numbers.get() == std::vector<int>{42, 42, 42});
+
+    using StrongCounter = fluent::NamedType<copy_move_counter, struct StrongCounterTag>;
+    copy_move_counter::reset();
+    StrongCounter const counter(std::in_place, 6, 7);
+    CHECK(counter.get().value == 42);
+    CHECK(copy_move_counter::copies == 0);
+    CHECK(copy_move_counter::moves == 0);
+
+    static_assert(noexcept(StrongVector(std::in_place)), "in place default construction is not noexcept");
+    static_assert(!noexcept(StrongVector(std::in_place, 3, 42)), "in place construction of a vector is noexcept");
+}
+
+TEST_CASE("make_named forwards its argument")
+{
+    copy_move_counter::reset();
+    auto const moved = fluent::make_named<Counted>(copy_move_counter(42));
+    static_assert(
+        std::is_same<decltype(moved), Counted<copy_move_counter> const>::value, "make_named deduced a wrong type");
+    CHECK(moved.get().value == 42);
+    CHECK(copy_move_counter::copies == 0);
+    CHECK(copy_move_counter::moves == 1);
+
+    copy_move_counter::reset();
+    copy_move_counter const lvalue(43);
+    auto const copied = fluent::make_named<Counted>(lvalue);
+    static_assert(
+        std::is_same<decltype(copied), Counted<copy_move_counter> const>::value, "make_named deduced a wrong type");
+    CHECK(copied.get().value == 43);
+    CHECK(copy_move_counter::copies == 1);
+    CHECK(copy_move_counter::moves == 0);
+}
+
+TEST_CASE("Named arguments construct their value in place")
+{
+    using Counter = fluent::NamedType<copy_move_counter, struct CounterTag>;
+    static const Counter::argument counter;
+
+    copy_move_counter::reset();
+    Counter const fromInt = (counter = 42);
+    CHECK(fromInt.get().value == 42);
+    CHECK(copy_move_counter::copies == 0);
+    CHECK(copy_move_counter::moves == 0);
+
+    copy_move_counter::reset();
+    Counter const fromValue = (counter = copy_move_counter(43));
+    CHECK(fromValue.get().value == 43);
+    CHECK(copy_move_counter::copies == 0);
+    CHECK(copy_move_counter::moves == 1);
+
+    copy_move_counter::reset();
+    Counter const fromStrong = (counter = Counter(copy_move_counter(44)));
+    CHECK(fromStrong.get().value == 44);
+    CHECK(copy_move_counter::copies == 0);
+}
+
+TEST_CASE("Named arguments don't convert their value explicitly")
+{
+    using Numbers = fluent::NamedType<std::vector<int>, struct NumbersTag>;
+    using Owner = fluent::NamedType<std::unique_ptr<int>, struct OwnerTag>;
+    static_assert(!std::is_assignable<Numbers::argument const&, int>::value, "explicit constructor of std::vector");
+    static_assert(!std::is_assignable<Owner::argument const&, int*&>::value, "explicit constructor of std::unique_ptr");
+    static_assert(std::is_assignable<Numbers::argument const&, std::vector<int>>::value, "no named argument of vector");
+    static_assert(std::is_assignable<Owner::argument const&, std::unique_ptr<int>>::value, "no named argument of owner");
+}
+
+TEST_CASE("Named arguments in any order are passed on without copies")
+{
+    using Left = fluent::NamedType<copy_move_counter, struct LeftTag>;
+    using Right = fluent::NamedType<copy_move_counter, struct RightTag>;
+
+    auto difference = fluent::make_named_arg_function<Left, Right>([](Left const& left, Right const& right)
+    {
+        return left.get().value - right.get().value;
+    });
+
+    Left const left(copy_move_counter(5));
+    Right const right(copy_move_counter(3));
+    copy_move_counter::reset();
+    CHECK(difference(left, right) == 2);
+    CHECK(difference(right, left) == 2);
+    CHECK(copy_move_counter::copies == 0);
+    CHECK(copy_move_counter::moves == 0);
+
+    copy_move_counter::reset();
+    CHECK(difference(Right(copy_move_counter(1)), Left(copy_move_counter(4))) == 3);
+    CHECK(copy_move_counter::copies == 0);
+    CHECK(copy_move_counter::moves == 2);
+
+    auto consume = fluent::make_named_arg_function<Left, Right>([](Left left_, Right&& right_)
+    {
+        Right const consumed = std::move(right_);
+        return left_.get().value + consumed.get().value;
+    });
+    copy_move_counter::reset();
+    CHECK(consume(Right(copy_move_counter(2)), Left(copy_move_counter(1))) == 3);
+    CHECK(copy_move_counter::copies == 0);
+    CHECK(copy_move_counter::moves == 4);
+}
+
+TEST_CASE("Named arguments in any order preserve references")
+{
+    using Total = fluent::NamedType<int, struct TotalTag>;
+    using Increment = fluent::NamedType<int, struct IncrementTag>;
+
+    auto accumulate = fluent::make_named_arg_function<Total, Increment>([](Total& total, Increment increment)
+    {
+        total.get() += increment.get();
+    });
+
+    Total total(1);
+    accumulate(Increment(2), total);
+    accumulate(total, Increment(3));
+    CHECK(total.get() == 6);
+}
+
+struct Distance : fluent::NamedType<double, fluent::derived<Distance>, fluent::Arithmetic>
+{
+    using NamedType::NamedType;
+};
+
+struct Label : fluent::NamedType<std::string, fluent::derived<Label>, fluent::Callable, fluent::Comparable>
+{
+    using NamedType::NamedType;
+};
+
+namespace std
+{
+template <>
+struct hash<Distance> : hash<Distance::NamedType>
+{
+};
+} // namespace std
+
+TEST_CASE("Strong types as derived classes")
+{
+    Distance a(1.5);
+    Distance const b(2.0);
+
+    static_assert(std::is_same<decltype(a + b), Distance>::value, "the skills don't return the derived class");
+    static_assert(std::is_same<decltype(++a), Distance&>::value, "the skills don't return the derived class");
+    static_assert(std::is_same<decltype(a++), Distance>::value, "the skills don't return the derived class");
+    static_assert(std::is_same<decltype(a * b), Distance>::value, "the skills don't return the derived class");
+    CHECK((a + b).get() == Approx(3.5));
+    CHECK((a * b).get() == Approx(3.0));
+    a += b;
+    CHECK(a.get() == Approx(3.5));
+    CHECK(b < a);
+    CHECK_FALSE(a == b);
+
+    std::ostringstream os;
+    os << b;
+    CHECK(os.str() == "2");
+    CHECK(std::hash<Distance>()(b) == std::hash<double>()(2.0));
+
+    static const Distance::argument distance;
+    Distance const fromArgument = (distance = 4.0);
+    CHECK(fromArgument.get() == Approx(4.0));
+
+    Distance::ref reference = a;
+    reference.get() = 1.0;
+    CHECK(a.get() == Approx(1.0));
+}
+
+TEST_CASE("Callable strong types as derived classes")
+{
+    Label label("label");
+    CHECK(label->size() == 5);
+    std::string const& text = label;
+    CHECK(text == "label");
+    std::string& mutableText = label;
+    mutableText += "s";
+    CHECK(label.get() == "labels");
+    CHECK((Label("a") < Label("b")));
+}
+
+TEST_CASE("Atomic strong types")
+{
+    using BytesSent = fluent::NamedType<std::int64_t, struct BytesSentTag, fluent::Addable, fluent::Subtractable>;
+    fluent::atomic<BytesSent> bytesSent(BytesSent{10});
+
+    CHECK(bytesSent.load().get() == 10);
+    bytesSent.store(BytesSent{20}, std::memory_order_release);
+    CHECK(bytesSent.load(std::memory_order_acquire).get() == 20);
+    CHECK(bytesSent.exchange(BytesSent{30}).get() == 20);
+
+    CHECK(bytesSent.fetch_add(BytesSent{5}, std::memory_order_relaxed).get() == 30);
+    CHECK(bytesSent.fetch_sub(BytesSent{15}).get() == 35);
+    CHECK(bytesSent.load().get() == 20);
+
+    BytesSent expected{0};
+    CHECK_FALSE(bytesSent.compare_exchange_strong(expected, BytesSent{40}));
+    CHECK(expected.get() == 20);
+    CHECK(bytesSent.compare_exchange_strong(
+        expected, BytesSent{40}, std::memory_order_acq_rel, std::memory_order_relaxed));
+    CHECK(bytesSent.load().get() == 40);
+    while (!bytesSent.compare_exchange_weak(expected, BytesSent{50}))
+    {
+    }
+    CHECK(bytesSent.load().get() == 50);
+
+    using Flags = fluent::NamedType<unsigned, struct FlagsTag, fluent::BitWiseAndable, fluent::BitWiseOrable,
+                                    fluent::BitWiseXorable>;
+    fluent::atomic<Flags> flags;
+    CHECK(flags.fetch_or(Flags{6u}).get() == 0u);
+    CHECK(flags.fetch_and(Flags{3u}).get() == 6u);
+    CHECK(flags.fetch_xor(Flags{3u}).get() == 2u);
+    CHECK(flags.load().get() == 1u);
+}
+
+TEST_CASE("Atomic strong types from several threads")
+{
+    using Requests = fluent::NamedType<std::uint64_t, struct RequestsTag, fluent::Addable>;
+    fluent::atomic<Requests> requests;
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&requests]() noexcept {
+            for (int request = 0; request < 10000; ++request)
+            {
+                requests.fetch_add(Requests{1}, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK(requests.load().get() == 40000u);
+}
+
+TEST_CASE("Sharded accumulation")
+{
+    using Requests = fluent::NamedType<std::uint64_t, struct RequestsTag, fluent::Addable>;
+    fluent::Sharded<Requests> requests(3);
+    CHECK(requests.shard_count() == 4u);
+    CHECK(requests.load().get() == 0u);
+
+    requests += Requests{2};
+    requests += Requests{3};
+    CHECK(requests.load().get() == 5u);
+}
+
+TEST_CASE("Rounding the number of shards up to a power of two")
+{
+    constexpr std::size_t largestPowerOfTwo = std::numeric_limits<std::size_t>::max() / 2 + 1;
+    CHECK(fluent::details::roundUpToPowerOfTwo(0) == 1u);
+    CHECK(fluent::details::roundUpToPowerOfTwo(5) == 8u);
+    CHECK(fluent::details::roundUpToPowerOfTwo(largestPowerOfTwo) == largestPowerOfTwo);
+    CHECK(fluent::details::roundUpToPowerOfTwo(largestPowerOfTwo + 1) == largestPowerOfTwo);
+    CHECK(fluent::details::roundUpToPowerOfTwo(std::numeric_limits<std::size_t>::max()) == largestPowerOfTwo);
+}
+
+TEST_CASE("Sharded accumulation from several threads")
+{
+    using Requests = fluent::NamedType<std::uint64_t, struct RequestsTag, fluent::Addable>;
+    fluent::Sharded<Requests> requests(2);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&requests]() noexcept {
+            for (int request = 0; request < 10000; ++request)
+            {
+                requests += Requests{1};
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK(requests.load().get() == 40000u);
+}
+
+TEST_CASE("Cache line aligned strong types")
+{
+    using Processed = fluent::NamedType<std::uint64_t, struct ProcessedTag, fluent::PreIncrementable,
+                                        fluent::Comparable, fluent::CacheLineAligned>;
+    static_assert(alignof(Processed) == fluent::cache_line_size, "");
+    static_assert(sizeof(Processed) == fluent::cache_line_size, "");
+    static_assert(!fluent::is_layout_compatible_with_underlying<Processed>::value, "");
+
+    std::array<Processed, 2> processed{};
+    ++processed[1];
+    CHECK((processed[0] == Processed{0}));
+    CHECK(processed[1].get() == 1u);
+    CHECK(reinterpret_cast<std::uintptr_t>(&processed[1]) - reinterpret_cast<std::uintptr_t>(&processed[0]) ==
+          fluent::cache_line_size);
+
+    std::vector<Processed> heapProcessed(3);
+    for (auto const& element : heapProcessed)
+    {
+        CHECK(reinterpret_cast<std::uintptr_t>(&element) % fluent::cache_line_size == 0u);
+    }
+}
+
+TEST_CASE("Strong vector")
+{
+    using NodeIndex = fluent::NamedType<std::uint32_t, struct NodeIndexTag, fluent::Comparable>;
+    using EdgeIndex = fluent::NamedType<std::uint32_t, struct EdgeIndexTag>;
+    fluent::StrongVector<NodeIndex, std::string> nodes = {"a", "b"};
+    nodes.push_back("c");
+
+    static_assert(std::is_same<decltype(nodes.size()), NodeIndex>::value, "");
+    auto const subscript = [](auto& vector, auto index) -> decltype(vector[index]) { return vector[index]; };
+    static_assert(std::is_invocable<decltype(subscript), decltype(nodes)&, NodeIndex>::value, "");
+    static_assert(!std::is_invocable<decltype(subscript), decltype(nodes)&, EdgeIndex>::value, "");
+    static_assert(!std::is_invocable<decltype(subscript), decltype(nodes)&, std::uint32_t>::value, "");
+    CHECK((nodes.size() == NodeIndex{3}));
+    CHECK(nodes[NodeIndex{1}] == "b");
+    nodes[NodeIndex{2}] += "d";
+    CHECK(nodes.at(NodeIndex{2}) == "cd");
+    CHECK_THROWS_AS(nodes.at(NodeIndex{3}), std::out_of_range);
+    CHECK(nodes.get() == std::vector<std::string>{"a", "b", "cd"});
+
+    std::string visited;
+    for (NodeIndex node : nodes.indices())
+    {
+        visited += nodes[node];
+    }
+    CHECK(visited == "abcd");
+
+    fluent::StrongVector<NodeIndex, int> const distances(NodeIndex{2}, 7);
+    CHECK((distances.size() == NodeIndex{2}));
+    CHECK(distances[NodeIndex{1}] == 7);
+}
+
+TEST_CASE("Strong vector holds as many elements as its index can designate")
+{
+    using SmallIndex = fluent::NamedType<std::uint8_t, struct SmallIndexTag, fluent::Comparable>;
+    std::vector<int> const values(255, 1);
+    fluent::StrongVector<SmallIndex, int> fromVector(values);
+    fluent::StrongVector<SmallIndex, int> const fromRange(values.begin(), values.end());
+    CHECK(fromVector.size().get() == 255);
+    CHECK(fromRange.size().get() == 255);
+    fromVector.pop_back();
+    fromVector.push_back(2);
+    CHECK(fromVector[SmallIndex{254}] == 2);
+}
+
+TEST_CASE("Strong iota ranges")
+{
+    using Position = fluent::NamedType<std::size_t, struct PositionTag, fluent::Comparable>;
+    fluent::StrongVector<Position, int> values = {1, 2, 3, 4};
+    CHECK((values.size() == Position{4}));
+
+    auto const range = fluent::strong_iota(Position{1}, values.size());
+    CHECK(range.size() == 3u);
+    CHECK((*(range.begin() + 2) == Position{3}));
+    CHECK(std::distance(range.begin(), range.end()) == 3);
+
+    std::vector<Position> positions(range.begin(), range.end());
+    CHECK((positions == std::vector<Position>{Position{1}, Position{2}, Position{3}}));
+    CHECK(fluent::strong_iota(Position{2}, Position{2}).empty());
+}
+
+TEST_CASE("Slot map")
+{
+    fluent::SlotMap<struct EntityTag, std::string, fluent::Comparable> names;
+    auto const first = names.insert("first");
+    auto const second = names.emplace(3, 'b');
+    using Handle = fluent::NamedType<std::uint64_t, EntityTag, fluent::Comparable>;
+    static_assert(std::is_same<decltype(names.insert("")), Handle>::value, "");
+
+    CHECK(names.size() == 2u);
+    CHECK((first != second));
+    CHECK(names[first] == "first");
+    CHECK(*names.find(second) == "bbb");
+
+    CHECK(names.erase(first));
+    CHECK(!names.erase(first));
+    CHECK(!names.contains(first));
+    CHECK(names.find(first) == nullptr);
+    CHECK_THROWS_AS(names.at(first), std::out_of_range);
+    CHECK(names.at(second) == "bbb");
+
+    // The slot of the erased element is reused, with another generation
+    auto const third = names.insert("third");
+    CHECK((third != first));
+    CHECK(!names.contains(first));
+    CHECK(names[third] == "third");
+    CHECK(names[second] == "bbb");
+
+    std::vector<std::string> const values(names.begin(), names.end());
+    CHECK(values == std::vector<std::string>{"bbb", "third"});
+    CHECK((names.handle_at(0) == second));
+    CHECK((names.handle_at(1) == third));
+
+    names.clear();
+    CHECK(names.empty());
+    CHECK(!names.contains(second));
+    CHECK(!names.contains(third));
+}
+
+TEST_CASE("Slot map keeps the handles of moved elements")
+{
+    fluent::SlotMap<struct EntityTag, int> values;
+    std::vector<fluent::NamedType<std::uint64_t, EntityTag>> handles;
+    for (int value = 0; value < 10; ++value)
+    {
+        handles.push_back(values.insert(value));
+    }
+    for (int value = 0; value < 10; value += 2)
+    {
+        values.erase(handles[static_cast<std::size_t>(value)]);
+    }
+
+    CHECK(values.size() == 5u);
+    for (int value = 0; value < 10; ++value)
+    {
+        auto const handle = handles[static_cast<std::size_t>(value)];
+        if (value % 2 == 0)
+        {
+            CHECK(values.find(handle) == nullptr);
+        }
+        else
+        {
+            CHECK(values[handle] == value);
+        }
+    }
+    for (std::size_t position = 0; position < values.size(); ++position)
+    {
+        CHECK(values[values.handle_at(position)] == values.data()[position]);
+    }
+}
+
+TEST_CASE("Slot map stays consistent when constructing an element throws")
+{
+    fluent::SlotMap<struct EntityTag, std::vector<int>, fluent::Comparable> values;
+    auto const first = values.emplace(1, 1);
+    auto const second = values.emplace(2, 2);
+    CHECK_THROWS_AS(values.emplace(std::numeric_limits<std::size_t>::max()), std::length_error);
+    CHECK(values.size() == 2u);
+
+    CHECK(values.erase(first));
+    CHECK(values[second] == std::vector<int>{2, 2});
+    CHECK((values.handle_at(0) == second));
+    auto const third = values.emplace(3, 3);
+    CHECK(values[third] == std::vector<int>{3, 3, 3});
+}
+
+struct SessionIdTag
+{
+    static constexpr std::uint64_t invalid_value = ~std::uint64_t{0};
+};
+
+template <typename Map>
+void checkStrongHashMap()
+{
+    using Key = typename Map::key_type;
+    Map map;
+    CHECK(map.find(Key{1}) == nullptr);
+
+    for (std::uint64_t key = 0; key < 1000; ++key)
+    {
+        CHECK(map.try_emplace(Key{key}, std::to_string(key)).second);
+    }
+    CHECK(!map.try_emplace(Key{7}, "other").second);
+    CHECK(map.size() == 1000u);
+    CHECK(*map.find(Key{7}) == "7");
+
+    // A key already in a full map is found without growing it
+    Map full;
+    full[Key{0}];
+    for (std::uint64_t key = 1;; ++key)
+    {
+        Map grown = full;
+        grown[Key{key}];
+        if (grown.capacity() != full.capacity())
+        {
+            break;
+        }
+        full = std::move(grown);
+    }
+    auto const fullCapacity = full.capacity();
+    full[Key{0}];
+    CHECK(full.capacity() == fullCapacity);
+
+    for (std::uint64_t key = 0; key < 1000; key += 2)
+    {
+        CHECK(map.erase(Key{key}));
+    }
+    CHECK(!map.erase(Key{0}));
+    CHECK(map.size() == 500u);
+    for (std::uint64_t key = 0; key < 1000; ++key)
+    {
+        auto const* value = map.find(Key{key});
+        if (key % 2 == 0)
+        {
+            CHECK(value == nullptr);
+        }
+        else
+        {
+            REQUIRE(value != nullptr);
+            CHECK(*value == std::to_string(key));
+        }
+    }
+
+    map[Key{2000}] += "a";
+    map[Key{2000}] += "b";
+    CHECK(*map.find(Key{2000}) == "ab");
+    CHECK(!map.insert_or_assign(Key{2000}, "c").second);
+    CHECK(*map.find(Key{2000}) == "c");
+
+    std::uint64_t keySum = 0;
+    std::size_t count = 0;
+    map.for_each([&keySum, &count](Key const& key, std::string const&) {
+        keySum += key.get();
+        ++count;
+    });
+    CHECK(count == 501u);
+    CHECK(keySum == 250000u + 2000u);
+
+    Map const copy = map;
+    Map moved = std::move(map);
+    CHECK(copy.size() == 501u);
+    CHECK(moved.size() == 501u);
+    CHECK(*copy.find(Key{999}) == "999");
+    CHECK(*moved.find(Key{999}) == "999");
+
+    moved.clear();
+    CHECK(moved.empty());
+    CHECK(moved.find(Key{999}) == nullptr);
+    CHECK(copy.contains(Key{999}));
+}
+
+TEST_CASE("Strong hash map")
+{
+    using ConnectionId = fluent::NamedType<std::uint64_t, struct ConnectionIdTag, fluent::Hashable>;
+    using Map = fluent::StrongHashMap<ConnectionId, std::string>;
+    static_assert(std::is_same<Map, fluent::details::ControlByteHashMap<ConnectionId, std::string>>::value, "");
+    checkStrongHashMap<Map>();
+}
+
+TEST_CASE("Strong hash map with an invalid key")
+{
+    using SessionId = fluent::NamedType<std::uint64_t, SessionIdTag, fluent::Hashable>;
+    using Map = fluent::StrongHashMap<SessionId, std::string>;
+    static_assert(std::is_same<Map, fluent::details::InvalidKeyHashMap<SessionId, std::string>>::value, "");
+    // Erasing from the table without control bytes moves the values, which must not throw
+    struct ThrowingMove
+    {
+        ThrowingMove() = default;
+        ThrowingMove(ThrowingMove&&) noexcept(false)
+        {
+        }
+    };
+    using ThrowingMoveMap = fluent::StrongHashMap<SessionId, ThrowingMove>;
+    static_assert(std::is_same<ThrowingMoveMap, fluent::details::ControlByteHashMap<SessionId, ThrowingMove>>::value,
+                  "");
+    checkStrongHashMap<Map>();
+
+    Map map;
+    CHECK_THROWS_AS(map[SessionId{SessionIdTag::invalid_value}], std::invalid_argument);
+    CHECK(map.find(SessionId{SessionIdTag::invalid_value}) == nullptr);
+}
+
+TEST_CASE("Branchless lower and upper bounds")
+{
+    using Key = fluent::NamedType<int, struct BoundKeyTag>;
+    fluent::details::UnderlyingLess const less;
+    std::vector<Key> keys;
+    for (int size = 0; size < 40; ++size)
+    {
+        for (int value = -1; value <= 2 * size + 1; ++value)
+        {
+            Key const key{value};
+            auto const expectedLower = std::lower_bound(keys.begin(), keys.end(), key, less);
+            auto const expectedUpper = std::upper_bound(keys.begin(), keys.end(), key, less);
+            auto const* lower = fluent::details::branchlessLowerBound(keys.data(), keys.size(), key, less);
+            auto const* upper = fluent::details::branchlessUpperBound(keys.data(), keys.size(), key, less);
+            CHECK(lower - keys.data() == expectedLower - keys.begin());
+            CHECK(upper - keys.data() == expectedUpper - keys.begin());
+        }
+        // Pairs of equal keys, to check the bounds of the equal ranges
+        keys.push_back(Key{size - size % 2});
+    }
+}
+
+TEST_CASE("Strong flat set")
+{
+    using Id = fluent::NamedType<int, struct FlatSetIdTag, fluent::Comparable>;
+    fluent::StrongFlatSet<Id> ids(std::vector<Id>{Id{5}, Id{1}, Id{3}, Id{1}, Id{5}});
+    CHECK((ids.get() == std::vector<Id>{Id{1}, Id{3}, Id{5}}));
+    CHECK(ids.contains(Id{3}));
+    CHECK(!ids.contains(Id{4}));
+    CHECK(ids.count(Id{5}) == 1u);
+    CHECK((*ids.lower_bound(Id{2}) == Id{3}));
+    CHECK((*ids.upper_bound(Id{3}) == Id{5}));
+    CHECK(ids.find(Id{6}) == ids.end());
+
+    CHECK(ids.insert(Id{4}).second);
+    CHECK(!ids.insert(Id{4}).second);
+    ids.insert({Id{9}, Id{0}, Id{3}, Id{9}});
+    CHECK((ids.get() == std::vector<Id>{Id{0}, Id{1}, Id{3}, Id{4}, Id{5}, Id{9}}));
+
+    ids.merge(fluent::StrongFlatSet<Id>{Id{2}, Id{9}, Id{10}});
+    CHECK((ids.get() == std::vector<Id>{Id{0}, Id{1}, Id{2}, Id{3}, Id{4}, Id{5}, Id{9}, Id{10}}));
+    ids.merge(ids);
+    ids.insert(ids.begin(), ids.end());
+    CHECK((ids.get() == std::vector<Id>{Id{0}, Id{1}, Id{2}, Id{3}, Id{4}, Id{5}, Id{9}, Id{10}}));
+
+    CHECK(ids.erase(Id{3}) == 1u);
+    CHECK(ids.erase(Id{3}) == 0u);
+    CHECK(ids.size() == 7u);
+    std::vector<Id> const expected = {Id{0}, Id{1}, Id{2}, Id{4}, Id{5}, Id{9}, Id{10}};
+    CHECK((ids == fluent::StrongFlatSet<Id>(fluent::sorted_unique, expected)));
+}
+
+TEST_CASE("Strong flat map")
+{
+    using Id = fluent::NamedType<int, struct FlatMapIdTag, fluent::Comparable>;
+    fluent::StrongFlatMap<Id, std::string> names = {{Id{3}, "c"}, {Id{1}, "a"}, {Id{3}, "other c"}, {Id{2}, "b"}};
+    CHECK((names.keys() == std::vector<Id>{Id{1}, Id{2}, Id{3}}));
+    CHECK(names.values() == std::vector<std::string>{"a", "b", "c"});
+    CHECK(*names.find(Id{2}) == "b");
+    CHECK(names.find(Id{4}) == nullptr);
+    CHECK(names.lower_bound(Id{2}) == 1u);
+    CHECK(names.upper_bound(Id{2}) == 2u);
+
+    names[Id{0}] = "zero";
+    CHECK(!names.try_emplace(Id{0}, "other zero").second);
+    CHECK(!names.insert_or_assign(Id{1}, "A").second);
+    names.insert({{Id{5}, "e"}, {Id{2}, "other b"}, {Id{4}, "d"}, {Id{5}, "other e"}});
+
+    std::string visited;
+    names.for_each([&visited](Id const&, std::string const& name) { visited += name + ","; });
+    CHECK(visited == "zero,A,b,c,d,e,");
+
+    CHECK(names.erase(Id{2}) == 1u);
+    CHECK(names.erase(Id{2}) == 0u);
+    CHECK(names.size() == 5u);
+    CHECK(!names.contains(Id{2}));
+}
+
+TEST_CASE("Strong flat map stays consistent when constructing a value throws")
+{
+    using Id = fluent::NamedType<int, struct FlatMapIdTag, fluent::Comparable>;
+    fluent::StrongFlatMap<Id, std::vector<int>> lists(fluent::sorted_unique, {Id{1}, Id{3}}, {{1}, {3, 3, 3}});
+    CHECK_THROWS_AS(lists.try_emplace(Id{2}, std::numeric_limits<std::size_t>::max()), std::length_error);
+    CHECK((lists.keys() == std::vector<Id>{Id{1}, Id{3}}));
+    CHECK(lists.values().size() == 2u);
+    CHECK(*lists.find(Id{3}) == std::vector<int>{3, 3, 3});
+}
+
+namespace
+{
+// A value whose move may throw, and throws for the fragile ones
+struct FragileValue
+{
+    explicit FragileValue(std::string valueName) : name(std::move(valueName))
+    {
+    }
+    FragileValue(FragileValue const&) = default;
+    FragileValue(FragileValue&& other) noexcept(false) : name(other.name)
+    {
+        if (name == "fragile")
+        {
+            throw std::runtime_error("moving a fragile value");
+        }
+    }
+    FragileValue& operator=(FragileValue const&) = default;
+    FragileValue& operator=(FragileValue&&) = default;
+    ~FragileValue() = default;
+
+    std::string name = {};
+};
+} // namespace
+
+TEST_CASE("Strong flat map copies the values whose move may throw when inserting a batch")
+{
+    using Id = fluent::NamedType<int, struct FlatMapIdTag, fluent::Comparable>;
+    FragileValue const fragile{"fragile"};
+    fluent::StrongFlatMap<Id, FragileValue> values;
+    values.try_emplace(Id{1}, fragile);
+    values.try_emplace(Id{3}, fragile);
+    values.insert({{Id{2}, FragileValue{"b"}}, {Id{4}, FragileValue{"d"}}});
+    CHECK((values.keys() == std::vector<Id>{Id{1}, Id{2}, Id{3}, Id{4}}));
+    CHECK(values.find(Id{3})->name == "fragile");
+    CHECK(values.find(Id{4})->name == "d");
+}
+
+namespace
+{
+// Sorts pseudo-random values over the whole range of the underlying type, apart from NaNs, below and above the size
+// where radix_sort stops calling std::stable_sort
+template <typename Underlying, typename Bits>
+void checkRadixSort()
+{
+    using Strong = fluent::NamedType<Underlying, struct RadixSortTag>;
+    auto const less = [](Strong const& lhs, Strong const& rhs) { return lhs.get() < rhs.get(); };
+    std::uint64_t state = 42;
+    for (std::size_t size : {std::size_t{0}, std::size_t{10}, std::size_t{3000}})
+    {
+        std::vector<Strong> values;
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            Bits const bits = static_cast<Bits>(state >> (64 - sizeof(Bits) * 8));
+            Underlying value;
+            std::memcpy(&value, &bits, sizeof(value));
+            if (!std::isnan(value))
+            {
+                values.push_back(Strong{value});
+            }
+        }
+        auto expected = values;
+        std::stable_sort(expected.begin(), expected.end(), less);
+        fluent::radix_sort(values.begin(), values.end());
+        CHECK(std::is_sorted(values.begin(), values.end(), less));
+        CHECK(std::equal(values.begin(), values.end(), expected.begin(), expected.end(),
+                         [&less](Strong const& lhs, Strong const& rhs) { return !less(lhs, rhs) && !less(rhs, lhs); }));
+    }
+}
+} // namespace
+
+TEST_CASE("Radix sort of integral strong types")
+{
+    checkRadixSort<std::uint8_t, std::uint8_t>();
+    checkRadixSort<std::int8_t, std::uint8_t>();
+    checkRadixSort<std::int16_t, std::uint16_t>();
+    checkRadixSort<std::uint32_t, std::uint32_t>();
+    checkRadixSort<std::int32_t, std::uint32_t>();
+    checkRadixSort<std::uint64_t, std::uint64_t>();
+    checkRadixSort<std::int64_t, std::uint64_t>();
+}
+
+TEST_CASE("Radix sort of floating point strong types")
+{
+    using Celsius = fluent::NamedType<double, struct RadixCelsiusTag>;
+    std::vector<Celsius> temperatures;
+    for (int index = 0; index < 2000; ++index)
+    {
+        temperatures.push_back(Celsius{(index % 2 == 0 ? -1.5 : 1.25) * (index % 37)});
+    }
+    temperatures.push_back(Celsius{std::numeric_limits<double>::infinity()});
+    temperatures.push_back(Celsius{-std::numeric_limits<double>::infinity()});
+    temperatures.push_back(Celsius{std::numeric_limits<double>::lowest()});
+    temperatures.push_back(Celsius{std::numeric_limits<double>::denorm_min()});
+    temperatures.push_back(Celsius{-0.0});
+    fluent::radix_sort(temperatures.begin(), temperatures.end());
+    CHECK(std::is_sorted(temperatures.begin(), temperatures.end(),
+                         [](Celsius const& lhs, Celsius const& rhs) { return lhs.get() < rhs.get(); }));
+    CHECK(temperatures.front().get() == -std::numeric_limits<double>::infinity());
+    CHECK(temperatures[1].get() == std::numeric_limits<double>::lowest());
+    CHECK(temperatures.back().get() == std::numeric_limits<double>::infinity());
+    auto const zero = std::find_if(temperatures.begin(), temperatures.end(), [](Celsius const& temperature) {
+        return std::fpclassify(temperature.get()) == FP_ZERO;
+    });
+    CHECK(std::signbit(zero->get()));
+
+    checkRadixSort<float, std::uint32_t>();
+}
+
+TEST_CASE("Radix sort of records by a projection")
+{
+    using Timestamp = fluent::NamedType<std::int64_t, struct RadixTimestampTag>;
+    struct Event
+    {
+        Timestamp timestamp{};
+        std::size_t order = 0;
+    };
+    std::vector<Event> events;
+    for (std::size_t index = 0; index < 2000; ++index)
+    {
+        // Few distinct timestamps, to check that the events with the same one stay in their order
+        events.push_back(Event{Timestamp{static_cast<std::int64_t>(index * 7919 % 101) - 50}, index});
+    }
+    auto expected = events;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](Event const& lhs, Event const& rhs) { return lhs.timestamp.get() < rhs.timestamp.get(); });
+    fluent::radix_sort(events.begin(), events.end(), [](Event const& event) { return event.timestamp; });
+    CHECK(std::equal(events.begin(), events.end(), expected.begin(), expected.end(),
+                     [](Event const& lhs, Event const& rhs) { return lhs.order == rhs.order; }));
+
+    // With an arithmetic projection, and keys that are all equal
+    fluent::radix_sort(events.begin(), events.end(), [](Event const&) { return 0u; });
+    CHECK(std::equal(events.begin(), events.end(), expected.begin(), expected.end(),
+                     [](Event const& lhs, Event const& rhs) { return lhs.order == rhs.order; }));
+}
+
+namespace
+{
+using RadixTimestamp = fluent::NamedType<std::int32_t, struct RadixTimestampTag>;
+
+// Records without a default constructor, that radix_sort moves to its buffer, with a move constructor that may throw
+// (by copying the name) or not
+template <bool NothrowMove>
+struct TimestampedName
+{
+    TimestampedName(RadixTimestamp timestamp_, std::string name_) noexcept
+        : timestamp(timestamp_), name(std::move(name_))
+    {
+    }
+    TimestampedName(TimestampedName const&) = default;
+    TimestampedName(TimestampedName&& other) noexcept(NothrowMove)
+        : timestamp(other.timestamp), name(NothrowMove ? std::move(other.name) : other.name)
+    {
+    }
+    TimestampedName& operator=(TimestampedName const&) = default;
+    TimestampedName& operator=(TimestampedName&&) = default;
+    ~TimestampedName() = default;
+
+    RadixTimestamp timestamp;
+    std::string name;
+};
+
+template <bool NothrowMove>
+void checkRadixSortWithoutDefaultConstructor()
+{
+    using Record = TimestampedName<NothrowMove>;
+    static_assert(!std::is_default_constructible<Record>::value, "the records have a default constructor");
+    std::vector<Record> records;
+    for (int index = 0; index < 3000; ++index)
+    {
+        records.emplace_back(RadixTimestamp{(index * 7919) % 3001 - 1500}, std::to_string(index));
+    }
+    auto const byTimestamp = [](Record const& lhs, Record const& rhs) {
+        return lhs.timestamp.get() < rhs.timestamp.get();
+    };
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), byTimestamp);
+    fluent::radix_sort(records.begin(), records.end(), [](Record const& record) { return record.timestamp; });
+    CHECK(std::equal(records.begin(), records.end(), expected.begin(), expected.end(),
+                     [](Record const& lhs, Record const& rhs) { return lhs.name == rhs.name; }));
+}
+} // namespace
+
+TEST_CASE("Radix sort of records without a default constructor")
+{
+    checkRadixSortWithoutDefaultConstructor<true>();
+    checkRadixSortWithoutDefaultConstructor<false>();
+}
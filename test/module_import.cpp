@@ -0,0 +1,15 @@
+// Imports the fluent.named_type module rather than including the headers, to check that its exported names are usable
+// and that the std::hash specializations, which only come from the global module fragment, reach its importers.
+
+#include <cstdint>
+#include <unordered_set>
+
+import fluent.named_type;
+
+using UserId = fluent::NamedType<std::uint64_t, struct UserIdTag, fluent::Hashable, fluent::Comparable>;
+
+int main()
+{
+    std::unordered_set<UserId> const ids = {UserId{1}, UserId{2}, UserId{1}};
+    return ids.size() == 2 && ids.count(UserId{2}) == 1 ? 0 : 1;
+}